@@ -0,0 +1,74 @@
+#ifndef MY_ALLOCATOR_H
+#define MY_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+/*! alignment (in bytes) of every buffer handed out by aligned_new_array,
+ *  one cache line, which is also wide enough for 512-bit vector loads
+ */
+const size_t MY_ALIGNMENT = 64;
+
+/*! aligned array allocation, allocates n value-initialized T's
+ * @brief aligned array alloc., allocates n value-initialized T objects
+ * @pre none
+ * @param[in] n amount of T objects to allocate
+ * @post allocates a MY_ALIGNMENT aligned buffer and constructs n T's in it
+ * @returns pointer to first element of aligned buffer, nullptr if n == 0
+ */
+template <typename T>
+T* aligned_new_array(const size_t n)
+{
+    if(n == 0)
+        return nullptr;
+
+    // over-allocate so the buffer can be shifted up to the next aligned
+    // address, keeping the original pointer just in front of the data
+    void *raw = ::operator new(n * sizeof(T) + MY_ALIGNMENT + sizeof(void*));
+    uintptr_t start = reinterpret_cast<uintptr_t>(raw) + sizeof(void*);
+    uintptr_t aligned = (start + MY_ALIGNMENT - 1) & ~uintptr_t(MY_ALIGNMENT - 1);
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+
+    T *data = reinterpret_cast<T*>(aligned);
+    for(size_t i = 0; i < n; i++)
+        new (data + i) T();
+    return data;
+}
+
+/*! aligned array deallocation, destroys and frees array from aligned_new_array
+ * @brief aligned array dealloc., frees array made by aligned_new_array
+ * @pre data must be nullptr or returned by aligned_new_array<T>(n)
+ * @param[in] data pointer to first element of the aligned buffer
+ * @param[in] n amount of T objects in the buffer
+ * @post destroys the n T's and frees the underlying buffer
+ */
+template <typename T>
+void aligned_delete_array(T *data, const size_t n)
+{
+    if(data == nullptr)
+        return;
+
+    for(size_t i = 0; i < n; i++)
+        data[i].~T();
+    ::operator delete(reinterpret_cast<void**>(data)[-1]);
+}
+
+/*! padded stride, rounds a row length up so every row starts aligned
+ * @brief padded stride, rounds n up to a whole number of aligned blocks
+ * @pre none
+ * @param[in] n amount of T's in one row
+ * @post rounds n up so n * sizeof(T) is a multiple of MY_ALIGNMENT, when
+ *       sizeof(T) evenly divides MY_ALIGNMENT (otherwise n is unchanged)
+ * @returns the padded row length in elements
+ */
+template <typename T>
+size_t padded_stride(const size_t n)
+{
+    if(MY_ALIGNMENT % sizeof(T) != 0)
+        return n;
+    const size_t per_block = MY_ALIGNMENT / sizeof(T);
+    return (n + per_block - 1) / per_block * per_block;
+}
+
+#endif
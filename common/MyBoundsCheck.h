@@ -0,0 +1,44 @@
+#ifndef MY_BOUNDS_CHECK_H
+#define MY_BOUNDS_CHECK_H
+
+#include <cstddef>
+#include <stdexcept>
+
+/*! bounds checking of the container subscripts
+ *
+ * the subscripts of MyNumVector, MyVector, MyMatrix, MyRowView and
+ * MySparseMatrix check their index with check_index. the check is a
+ * branch and a possible throw in every access, which keeps the compiler
+ * from vectorizing loops over the elements, so it is only compiled in
+ * while MY_BOUNDS_CHECK is nonzero. that follows assert: debug builds
+ * (the -g builds of the Makefiles) check, builds with -DNDEBUG do not.
+ * -DMY_BOUNDS_CHECK=0 or =1 picks a mode regardless of NDEBUG; every
+ * translation unit of a program must be built with the same mode.
+ */
+#ifndef MY_BOUNDS_CHECK
+#ifdef NDEBUG
+#define MY_BOUNDS_CHECK 0
+#else
+#define MY_BOUNDS_CHECK 1
+#endif
+#endif
+
+/*! true while container subscripts check their indices */
+const bool BOUNDS_CHECKED = MY_BOUNDS_CHECK != 0;
+
+/*! check index function, checks an index against a size
+ * @brief check index, throws if i is not below n in checked builds
+ * @pre none
+ * @param[in] i index given to a subscript
+ * @param[in] n amount of valid indices
+ * @param[in] msg message of the exception
+ * @throw std::out_of_range if BOUNDS_CHECKED and i >= n
+ * @post does nothing (and compiles to nothing) in unchecked builds
+ */
+inline void check_index(const size_t i, const size_t n, const char *msg)
+{
+    if(BOUNDS_CHECKED && i >= n)
+        throw std::out_of_range(msg);
+}
+
+#endif
@@ -0,0 +1,605 @@
+#ifndef MY_GEMM_H
+#define MY_GEMM_H
+
+#include <algorithm>
+#include <cstddef>
+#include "MyAllocator.h"
+#include "MyThreadPool.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+
+/*! general matrix multiply, c += a * b on row-major blocks of memory
+ *
+ * the operands are cut into blocks that stay cache resident: a
+ * GEMM_BLOCK_K x GEMM_BLOCK_N block of b is copied ("packed") into strips
+ * of kernel-width columns, a GEMM_BLOCK_M x GEMM_BLOCK_K block of a into
+ * strips of kernel-height rows, and a register-blocked micro-kernel then
+ * multiplies one strip of each, keeping its whole tile of c in registers
+ * for the length of the strips. the float and double kernels use AVX2/FMA
+ * or AVX-512 when the cpu running the program supports them, picked once
+ * at runtime, and any other T (or cpu) uses the portable scalar kernel.
+ * large products split the rows of c into bands of whole blocks that run
+ * on the shared container thread pool.
+ */
+
+/*! rows of a packed per block, sized so a packed block of a stays in L2
+ */
+const size_t GEMM_BLOCK_M = 72;
+
+/*! depth of a packed block, sized so one strip of packed b stays in L1
+ */
+const size_t GEMM_BLOCK_K = 256;
+
+/*! columns of b packed per block, sized so a packed block of b stays in L2
+ */
+const size_t GEMM_BLOCK_N = 512;
+
+/*! products (m * n * k) below which blocking costs more than it saves, so
+ *  gemm() runs the plain loops instead
+ */
+const size_t GEMM_BLOCKING_MIN_WORK = 32 * 32 * 32;
+
+/*! instruction set the float and double gemm kernels run with
+ */
+enum GemmIsa { GEMM_SCALAR, GEMM_AVX2, GEMM_AVX512 };
+
+/*! gemm isa function, returns the widest kernel the cpu can run
+ * @brief gemm isa function, detects widest usable instruction set once
+ * @pre none
+ * @post queries the cpu on the first call, later calls reuse the answer
+ * @returns GEMM_AVX512, GEMM_AVX2 (with FMA) or GEMM_SCALAR
+ */
+inline GemmIsa gemm_isa()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    static const GemmIsa isa = __builtin_cpu_supports("avx512f") ? GEMM_AVX512 :
+        (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) ?
+        GEMM_AVX2 : GEMM_SCALAR;
+    return isa;
+#else
+    return GEMM_SCALAR;
+#endif
+}
+
+/*! pack a function, copies a block of a into strips of mr rows
+ * @brief pack a function, lays block of a out as the kernels read it
+ * @pre packed must hold ceil(mc / mr) * mr * kc T's
+ * @param[in] a first element of the (mc x kc) block, row-major
+ * @param[in] lda distance between rows of a, in elements
+ * @param[in] mc rows in the block
+ * @param[in] kc columns in the block
+ * @param[in] mr rows per strip, the kernel height
+ * @param[out] packed strip after strip, each storing its mr rows column by
+ *             column; rows past mc are zero
+ */
+template <typename T>
+void gemm_pack_a(const T *a, const size_t lda, const size_t mc,
+    const size_t kc, const size_t mr, T *packed)
+{
+    for(size_t i = 0; i < mc; i += mr)
+    {
+        const size_t rows = std::min(mr, mc - i);
+        for(size_t p = 0; p < kc; p++)
+        {
+            for(size_t r = 0; r < rows; r++)
+                packed[r] = a[(i + r) * lda + p];
+            for(size_t r = rows; r < mr; r++)
+                packed[r] = T();
+            packed += mr;
+        }
+    }
+}
+
+/*! pack b function, copies a block of b into strips of nr columns
+ * @brief pack b function, lays block of b out as the kernels read it
+ * @pre packed must hold ceil(nc / nr) * nr * kc T's
+ * @param[in] b first element of the (kc x nc) block, row-major
+ * @param[in] ldb distance between rows of b, in elements
+ * @param[in] kc rows in the block
+ * @param[in] nc columns in the block
+ * @param[in] nr columns per strip, the kernel width
+ * @param[out] packed strip after strip, each storing its nr columns row by
+ *             row; columns past nc are zero
+ */
+template <typename T>
+void gemm_pack_b(const T *b, const size_t ldb, const size_t kc,
+    const size_t nc, const size_t nr, T *packed)
+{
+    for(size_t j = 0; j < nc; j += nr)
+    {
+        const size_t cols = std::min(nr, nc - j);
+        for(size_t p = 0; p < kc; p++)
+        {
+            const T *b_row = b + p * ldb + j;
+            for(size_t s = 0; s < cols; s++)
+                packed[s] = b_row[s];
+            for(size_t s = cols; s < nr; s++)
+                packed[s] = T();
+            packed += nr;
+        }
+    }
+}
+
+/*! scalar gemm kernel, portable register-blocked kernel for any T
+ * @brief GemmScalarKernel struct, c tile += a strip * b strip in plain C++
+ */
+template <typename T>
+struct GemmScalarKernel
+{
+    static const size_t rows = 4; //! rows of c per tile
+    static const size_t cols = 4; //! columns of c per tile
+
+    /*! run function, adds the product of one a strip and one b strip to c
+     * @brief run function, c tile += packed a strip * packed b strip
+     * @pre a and b are strips packed by gemm_pack_a/gemm_pack_b with this
+     *      kernel's rows and cols, c has room for a rows x cols tile
+     * @param[in] kc depth of the strips
+     * @param[in] a packed strip of a
+     * @param[in] b packed strip of b
+     * @param[in,out] c first element of the tile of c
+     * @param[in] ldc distance between rows of c, in elements
+     * @post accumulates the whole tile before touching c once
+     */
+    static void run(const size_t kc, const T *a, const T *b, T *c,
+        const size_t ldc)
+    {
+        T acc[rows][cols];
+        for(size_t r = 0; r < rows; r++)
+            for(size_t s = 0; s < cols; s++)
+                acc[r][s] = T();
+        for(size_t p = 0; p < kc; p++)
+        {
+            for(size_t r = 0; r < rows; r++)
+                for(size_t s = 0; s < cols; s++)
+                    acc[r][s] += a[r] * b[s];
+            a += rows;
+            b += cols;
+        }
+        for(size_t r = 0; r < rows; r++)
+            for(size_t s = 0; s < cols; s++)
+                c[r * ldc + s] += acc[r][s];
+    }
+};
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+
+/*! avx2 vector traits, 256-bit operations on floats or doubles
+ * @brief Avx2Vec struct, maps the kernel's vector ops to AVX2/FMA
+ */
+template <typename T>
+struct Avx2Vec;
+
+template <>
+struct Avx2Vec<double>
+{
+    typedef __m256d vec; //! register of doubles
+    static const size_t width = 4; //! doubles per register
+
+    __attribute__((target("avx2,fma")))
+    static vec zero() { return _mm256_setzero_pd(); }
+    __attribute__((target("avx2,fma")))
+    static vec broadcast(const double x) { return _mm256_set1_pd(x); }
+    __attribute__((target("avx2,fma")))
+    static vec load(const double *p) { return _mm256_loadu_pd(p); }
+    __attribute__((target("avx2,fma")))
+    static void store(double *p, const vec v) { _mm256_storeu_pd(p, v); }
+    __attribute__((target("avx2,fma")))
+    static vec add(const vec a, const vec b) { return _mm256_add_pd(a, b); }
+    __attribute__((target("avx2,fma")))
+    static vec fma(const vec a, const vec b, const vec c)
+        { return _mm256_fmadd_pd(a, b, c); }
+};
+
+template <>
+struct Avx2Vec<float>
+{
+    typedef __m256 vec; //! register of floats
+    static const size_t width = 8; //! floats per register
+
+    __attribute__((target("avx2,fma")))
+    static vec zero() { return _mm256_setzero_ps(); }
+    __attribute__((target("avx2,fma")))
+    static vec broadcast(const float x) { return _mm256_set1_ps(x); }
+    __attribute__((target("avx2,fma")))
+    static vec load(const float *p) { return _mm256_loadu_ps(p); }
+    __attribute__((target("avx2,fma")))
+    static void store(float *p, const vec v) { _mm256_storeu_ps(p, v); }
+    __attribute__((target("avx2,fma")))
+    static vec add(const vec a, const vec b) { return _mm256_add_ps(a, b); }
+    __attribute__((target("avx2,fma")))
+    static vec fma(const vec a, const vec b, const vec c)
+        { return _mm256_fmadd_ps(a, b, c); }
+};
+
+/*! avx-512 vector traits, 512-bit operations on floats or doubles
+ * @brief Avx512Vec struct, maps the kernel's vector ops to AVX-512F
+ */
+template <typename T>
+struct Avx512Vec;
+
+template <>
+struct Avx512Vec<double>
+{
+    typedef __m512d vec; //! register of doubles
+    static const size_t width = 8; //! doubles per register
+
+    __attribute__((target("avx512f")))
+    static vec zero() { return _mm512_setzero_pd(); }
+    __attribute__((target("avx512f")))
+    static vec broadcast(const double x) { return _mm512_set1_pd(x); }
+    __attribute__((target("avx512f")))
+    static vec load(const double *p) { return _mm512_loadu_pd(p); }
+    __attribute__((target("avx512f")))
+    static void store(double *p, const vec v) { _mm512_storeu_pd(p, v); }
+    __attribute__((target("avx512f")))
+    static vec add(const vec a, const vec b) { return _mm512_add_pd(a, b); }
+    __attribute__((target("avx512f")))
+    static vec fma(const vec a, const vec b, const vec c)
+        { return _mm512_fmadd_pd(a, b, c); }
+};
+
+template <>
+struct Avx512Vec<float>
+{
+    typedef __m512 vec; //! register of floats
+    static const size_t width = 16; //! floats per register
+
+    __attribute__((target("avx512f")))
+    static vec zero() { return _mm512_setzero_ps(); }
+    __attribute__((target("avx512f")))
+    static vec broadcast(const float x) { return _mm512_set1_ps(x); }
+    __attribute__((target("avx512f")))
+    static vec load(const float *p) { return _mm512_loadu_ps(p); }
+    __attribute__((target("avx512f")))
+    static void store(float *p, const vec v) { _mm512_storeu_ps(p, v); }
+    __attribute__((target("avx512f")))
+    static vec add(const vec a, const vec b) { return _mm512_add_ps(a, b); }
+    __attribute__((target("avx512f")))
+    static vec fma(const vec a, const vec b, const vec c)
+        { return _mm512_fmadd_ps(a, b, c); }
+};
+
+/*! avx2 gemm kernel, 6 x (2 registers) tile of c held in registers
+ * @brief GemmAvx2Kernel struct, c tile += a strip * b strip via AVX2/FMA
+ */
+template <typename T>
+struct GemmAvx2Kernel
+{
+    typedef Avx2Vec<T> V; //! vector operations of the kernel
+    static const size_t rows = 6; //! rows of c per tile
+    static const size_t cols = 2 * V::width; //! columns of c per tile
+
+    /*! run function, adds the product of one a strip and one b strip to c
+     * @brief run function, c tile += packed a strip * packed b strip
+     * @pre cpu supports AVX2 and FMA, a and b are strips packed with this
+     *      kernel's rows and cols, c has room for a rows x cols tile
+     * @param[in] kc depth of the strips
+     * @param[in] a packed strip of a
+     * @param[in] b packed strip of b
+     * @param[in,out] c first element of the tile of c
+     * @param[in] ldc distance between rows of c, in elements
+     * @post accumulates the whole tile in 12 registers, then adds it to c
+     */
+    __attribute__((target("avx2,fma")))
+    static void run(const size_t kc, const T *a, const T *b, T *c,
+        const size_t ldc)
+    {
+        typename V::vec acc[rows][2];
+        #pragma GCC unroll 8
+        for(size_t r = 0; r < rows; r++)
+        {
+            acc[r][0] = V::zero();
+            acc[r][1] = V::zero();
+        }
+        for(size_t p = 0; p < kc; p++)
+        {
+            typename V::vec b0 = V::load(b);
+            typename V::vec b1 = V::load(b + V::width);
+            #pragma GCC unroll 8
+            for(size_t r = 0; r < rows; r++)
+            {
+                typename V::vec a_r = V::broadcast(a[r]);
+                acc[r][0] = V::fma(a_r, b0, acc[r][0]);
+                acc[r][1] = V::fma(a_r, b1, acc[r][1]);
+            }
+            a += rows;
+            b += cols;
+        }
+        #pragma GCC unroll 8
+        for(size_t r = 0; r < rows; r++)
+        {
+            T *c_row = c + r * ldc;
+            V::store(c_row, V::add(V::load(c_row), acc[r][0]));
+            V::store(c_row + V::width,
+                V::add(V::load(c_row + V::width), acc[r][1]));
+        }
+    }
+};
+
+/*! avx-512 gemm kernel, 8 x (2 registers) tile of c held in registers
+ * @brief GemmAvx512Kernel struct, c tile += a strip * b strip via AVX-512
+ */
+template <typename T>
+struct GemmAvx512Kernel
+{
+    typedef Avx512Vec<T> V; //! vector operations of the kernel
+    static const size_t rows = 8; //! rows of c per tile
+    static const size_t cols = 2 * V::width; //! columns of c per tile
+
+    /*! run function, adds the product of one a strip and one b strip to c
+     * @brief run function, c tile += packed a strip * packed b strip
+     * @pre cpu supports AVX-512F, a and b are strips packed with this
+     *      kernel's rows and cols, c has room for a rows x cols tile
+     * @param[in] kc depth of the strips
+     * @param[in] a packed strip of a
+     * @param[in] b packed strip of b
+     * @param[in,out] c first element of the tile of c
+     * @param[in] ldc distance between rows of c, in elements
+     * @post accumulates the whole tile in 16 registers, then adds it to c
+     */
+    __attribute__((target("avx512f")))
+    static void run(const size_t kc, const T *a, const T *b, T *c,
+        const size_t ldc)
+    {
+        typename V::vec acc[rows][2];
+        #pragma GCC unroll 8
+        for(size_t r = 0; r < rows; r++)
+        {
+            acc[r][0] = V::zero();
+            acc[r][1] = V::zero();
+        }
+        for(size_t p = 0; p < kc; p++)
+        {
+            typename V::vec b0 = V::load(b);
+            typename V::vec b1 = V::load(b + V::width);
+            #pragma GCC unroll 8
+            for(size_t r = 0; r < rows; r++)
+            {
+                typename V::vec a_r = V::broadcast(a[r]);
+                acc[r][0] = V::fma(a_r, b0, acc[r][0]);
+                acc[r][1] = V::fma(a_r, b1, acc[r][1]);
+            }
+            a += rows;
+            b += cols;
+        }
+        #pragma GCC unroll 8
+        for(size_t r = 0; r < rows; r++)
+        {
+            T *c_row = c + r * ldc;
+            V::store(c_row, V::add(V::load(c_row), acc[r][0]));
+            V::store(c_row + V::width,
+                V::add(V::load(c_row + V::width), acc[r][1]));
+        }
+    }
+};
+
+#endif
+
+/*! blocked gemm function, c += a * b through packed blocks and Kernel
+ * @brief blocked gemm, c += a * b, tiling the work for Kernel
+ * @pre a is m x k, b is k x n and c is m x n, all row-major with the given
+ *      row distances; the cpu can run Kernel
+ * @param[in] m rows of a and c
+ * @param[in] n columns of b and c
+ * @param[in] k columns of a, rows of b
+ * @param[in] a first element of a
+ * @param[in] lda distance between rows of a, in elements
+ * @param[in] b first element of b
+ * @param[in] ldb distance between rows of b, in elements
+ * @param[in,out] c first element of c
+ * @param[in] ldc distance between rows of c, in elements
+ * @post adds a * b to c; tiles cut short by the edges of c are computed in
+ *       a scratch tile and only their valid part is added to c
+ */
+template <typename T, typename Kernel>
+void gemm_blocked(const size_t m, const size_t n, const size_t k,
+    const T *a, const size_t lda, const T *b, const size_t ldb, T *c,
+    const size_t ldc)
+{
+    const size_t mr = Kernel::rows;
+    const size_t nr = Kernel::cols;
+    const size_t block_m = (GEMM_BLOCK_M + mr - 1) / mr * mr;
+    const size_t block_n = (GEMM_BLOCK_N + nr - 1) / nr * nr;
+
+    // pack buffers only as large as the biggest block these operands need
+    const size_t a_size = std::min(block_m, (m + mr - 1) / mr * mr) *
+        std::min(GEMM_BLOCK_K, k);
+    const size_t b_size = std::min(block_n, (n + nr - 1) / nr * nr) *
+        std::min(GEMM_BLOCK_K, k);
+    T *a_packed = aligned_new_array<T>(a_size);
+    T *b_packed = aligned_new_array<T>(b_size);
+    T *edge = aligned_new_array<T>(mr * nr);
+
+    for(size_t jc = 0; jc < n; jc += block_n)
+    {
+        const size_t nc = std::min(block_n, n - jc);
+        for(size_t pc = 0; pc < k; pc += GEMM_BLOCK_K)
+        {
+            const size_t kc = std::min(GEMM_BLOCK_K, k - pc);
+            gemm_pack_b(b + pc * ldb + jc, ldb, kc, nc, nr, b_packed);
+            for(size_t ic = 0; ic < m; ic += block_m)
+            {
+                const size_t mc = std::min(block_m, m - ic);
+                gemm_pack_a(a + ic * lda + pc, lda, mc, kc, mr, a_packed);
+                for(size_t jr = 0; jr < nc; jr += nr)
+                {
+                    const size_t cols = std::min(nr, nc - jr);
+                    for(size_t ir = 0; ir < mc; ir += mr)
+                    {
+                        const size_t rows = std::min(mr, mc - ir);
+                        const T *a_strip = a_packed + ir * kc;
+                        const T *b_strip = b_packed + jr * kc;
+                        T *c_tile = c + (ic + ir) * ldc + jc + jr;
+                        if(rows == mr && cols == nr)
+                        {
+                            Kernel::run(kc, a_strip, b_strip, c_tile, ldc);
+                            continue;
+                        }
+
+                        for(size_t s = 0; s < mr * nr; s++)
+                            edge[s] = T();
+                        Kernel::run(kc, a_strip, b_strip, edge, nr);
+                        for(size_t r = 0; r < rows; r++)
+                            for(size_t s = 0; s < cols; s++)
+                                c_tile[r * ldc + s] += edge[r * nr + s];
+                    }
+                }
+            }
+        }
+    }
+
+    aligned_delete_array(a_packed, a_size);
+    aligned_delete_array(b_packed, b_size);
+    aligned_delete_array(edge, mr * nr);
+}
+
+/*! simple gemm function, c += a * b through plain i-k-j loops
+ * @brief simple gemm, c += a * b without blocking, for small products
+ * @pre a is m x k, b is k x n and c is m x n, all row-major
+ * @param[in] m rows of a and c
+ * @param[in] n columns of b and c
+ * @param[in] k columns of a, rows of b
+ * @param[in] a first element of a
+ * @param[in] lda distance between rows of a, in elements
+ * @param[in] b first element of b
+ * @param[in] ldb distance between rows of b, in elements
+ * @param[in,out] c first element of c
+ * @param[in] ldc distance between rows of c, in elements
+ * @post adds a * b to c, walking rows of b and c contiguously
+ */
+template <typename T>
+void gemm_simple(const size_t m, const size_t n, const size_t k,
+    const T *a, const size_t lda, const T *b, const size_t ldb, T *c,
+    const size_t ldc)
+{
+    for(size_t i = 0; i < m; i++)
+    {
+        const T *a_row = a + i * lda;
+        T *c_row = c + i * ldc;
+        for(size_t p = 0; p < k; p++)
+        {
+            const T a_val = a_row[p];
+            const T *b_row = b + p * ldb;
+            for(size_t j = 0; j < n; j++)
+                c_row[j] += a_val * b_row[j];
+        }
+    }
+}
+
+/*! parallel gemm function, c += a * b with Kernel, bands of c in parallel
+ * @brief parallel gemm, runs gemm_blocked on bands of rows of c
+ * @pre same as gemm_blocked
+ * @param[in] m rows of a and c
+ * @param[in] n columns of b and c
+ * @param[in] k columns of a, rows of b
+ * @param[in] a first element of a
+ * @param[in] lda distance between rows of a, in elements
+ * @param[in] b first element of b
+ * @param[in] ldb distance between rows of b, in elements
+ * @param[in,out] c first element of c
+ * @param[in] ldc distance between rows of c, in elements
+ * @post adds a * b to c; every band is a whole number of GEMM_BLOCK_M row
+ *       blocks, so a band packs b no more often than the serial run would
+ */
+template <typename T, typename Kernel>
+void gemm_parallel(const size_t m, const size_t n, const size_t k,
+    const T *a, const size_t lda, const T *b, const size_t ldb, T *c,
+    const size_t ldc)
+{
+    const size_t blocks = (m + GEMM_BLOCK_M - 1) / GEMM_BLOCK_M;
+    parallel_for(blocks, GEMM_BLOCK_M * n * k,
+        [&](const size_t lo, const size_t hi)
+    {
+        const size_t first = lo * GEMM_BLOCK_M;
+        const size_t last = std::min(m, hi * GEMM_BLOCK_M);
+        gemm_blocked<T, Kernel>(last - first, n, k, a + first * lda, lda, b,
+            ldb, c + first * ldc, ldc);
+    });
+}
+
+/*! gemm function, c += a * b for any T, with the portable kernel
+ * @brief gemm function, c += a * b, blocked when the product is large
+ * @pre a is m x k, b is k x n and c is m x n, all row-major; T must be
+ *      capable of addition and multiplication, T() must be zero
+ * @param[in] m rows of a and c
+ * @param[in] n columns of b and c
+ * @param[in] k columns of a, rows of b
+ * @param[in] a first element of a
+ * @param[in] lda distance between rows of a, in elements
+ * @param[in] b first element of b
+ * @param[in] ldb distance between rows of b, in elements
+ * @param[in,out] c first element of c
+ * @param[in] ldc distance between rows of c, in elements
+ * @post adds a * b to c
+ */
+template <typename T>
+void gemm(const size_t m, const size_t n, const size_t k, const T *a,
+    const size_t lda, const T *b, const size_t ldb, T *c, const size_t ldc)
+{
+    if(m * n * k < GEMM_BLOCKING_MIN_WORK)
+        gemm_simple(m, n, k, a, lda, b, ldb, c, ldc);
+    else
+        gemm_parallel<T, GemmScalarKernel<T>>(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+/*! gemm dispatch function, c += a * b with the widest kernel the cpu has
+ * @brief gemm dispatch, runs blocked gemm with AVX-512, AVX2 or scalar
+ * @pre a is m x k, b is k x n and c is m x n, all row-major
+ * @param[in] m rows of a and c
+ * @param[in] n columns of b and c
+ * @param[in] k columns of a, rows of b
+ * @param[in] a first element of a
+ * @param[in] lda distance between rows of a, in elements
+ * @param[in] b first element of b
+ * @param[in] ldb distance between rows of b, in elements
+ * @param[in,out] c first element of c
+ * @param[in] ldc distance between rows of c, in elements
+ * @post adds a * b to c
+ */
+template <typename T>
+void gemm_dispatch(const size_t m, const size_t n, const size_t k,
+    const T *a, const size_t lda, const T *b, const size_t ldb, T *c,
+    const size_t ldc)
+{
+    if(m * n * k < GEMM_BLOCKING_MIN_WORK)
+    {
+        gemm_simple(m, n, k, a, lda, b, ldb, c, ldc);
+        return;
+    }
+    switch(gemm_isa())
+    {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        case GEMM_AVX512:
+            gemm_parallel<T, GemmAvx512Kernel<T>>(m, n, k, a, lda, b, ldb, c, ldc);
+            return;
+        case GEMM_AVX2:
+            gemm_parallel<T, GemmAvx2Kernel<T>>(m, n, k, a, lda, b, ldb, c, ldc);
+            return;
+#endif
+        default:
+            gemm_parallel<T, GemmScalarKernel<T>>(m, n, k, a, lda, b, ldb, c, ldc);
+            return;
+    }
+}
+
+/*! gemm function, c += a * b on doubles, see gemm_dispatch
+ */
+inline void gemm(const size_t m, const size_t n, const size_t k,
+    const double *a, const size_t lda, const double *b, const size_t ldb,
+    double *c, const size_t ldc)
+{
+    gemm_dispatch(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+/*! gemm function, c += a * b on floats, see gemm_dispatch
+ */
+inline void gemm(const size_t m, const size_t n, const size_t k,
+    const float *a, const size_t lda, const float *b, const size_t ldb,
+    float *c, const size_t ldc)
+{
+    gemm_dispatch(m, n, k, a, lda, b, ldb, c, ldc);
+}
+
+#endif
@@ -0,0 +1,274 @@
+#ifndef MY_ITERATOR_H
+#define MY_ITERATOR_H
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+/*! My Iterator class, custom iterator over contiguous elements
+ * @brief My Iterator class, contiguous random-access iterator for
+ *        MyNumVector (and the vectors and row views built on it) so they
+ *        work with range based for loops and the std algorithms; use
+ *        MyIterator<const T> to iterate read-only
+ */
+template <typename T>
+class MyIterator
+{
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+#if __cplusplus > 201703L
+        typedef std::contiguous_iterator_tag iterator_concept;
+#endif
+        typedef typename std::remove_cv<T>::type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef T* pointer;
+        typedef T& reference;
+
+        /*! Default constructor, iterator pointing at nothing
+         * @brief Default constructor, creates a singular iterator
+         * @pre none
+         * @post creates a MyIterator object with a null ptr, which may only
+         *       be assigned to or compared with other null iterators
+         */
+        MyIterator(): ptr(nullptr) {}
+
+        /*! Paramterized constructor, give the pointer to type T
+         * @brief parameterized constructor, given the pointer to type T
+         * @pre none
+         * @param[in] ptr pointer to object of type T to be used for iterator
+         * @post creates a MyIterator object with this.ptr pointing to ptr
+         */
+        explicit MyIterator(T *ptr): ptr(ptr) {}
+
+        /*! Conversion constructor, creates read-only iter from mutable iter
+         * @brief conversion constructor, makes const iter from mutable iter
+         * @pre none
+         * @param[in] it mutable iterator to view as read-only
+         * @post creates an iterator to the same element as it
+         */
+        template <typename U, typename = typename std::enable_if<
+            std::is_same<const U, T>::value>::type>
+        MyIterator(const MyIterator<U> &it): ptr(it.base()) {}
+
+        /*! base function, returns the pointer iterated with
+         * @brief base function, returns pointer to the current element
+         * @pre none
+         * @post none
+         * @returns the ptr member variable
+         */
+        T* base() const {return ptr;}
+
+        /*! Dereference operator, returns the dereferenced pointer
+         * @brief Deference operator, returns the dereferenced ptr member var.
+         * @pre iterator must point at an element
+         * @post returns the deferenced ptr member var.
+         * @returns reference to the current element
+         */
+        T& operator*() const {return *ptr;}
+
+        /*! Member access operator, returns the pointer
+         * @brief member access operator, returns ptr member var.
+         * @pre iterator must point at an element
+         * @post none
+         * @returns pointer to the current element
+         */
+        T* operator->() const {return ptr;}
+
+        /*! Subscript operator, returns element n places away
+         * @brief Subscript operator, returns reference to *(this + n)
+         * @pre this + n must point at an element
+         * @param[in] n distance from the current element
+         * @post none
+         * @returns reference to the element n places away
+         */
+        T& operator[](const difference_type n) const {return ptr[n];}
+
+        /*! Increment operator, increments the pointer member variable
+         * @brief Increment operator, increments the ptr member variable
+         * @pre none
+         * @post increments the ptr member variable and returns calling obj
+         * @returns modified calling obj. after ptr is incremented
+         */
+        MyIterator<T>& operator++() {++ptr; return *this;}
+
+        /*! Postfix increment operator, increments the pointer member var.
+         * @brief postfix increment, increments ptr returning its old value
+         * @pre none
+         * @post increments the ptr member variable
+         * @returns copy of the calling obj. from before the increment
+         */
+        MyIterator<T> operator++(int)
+            {MyIterator<T> old(*this); ++ptr; return old;}
+
+        /*! Decrement operator, decrements the pointer member variable
+         * @brief Decrement operator, decrements the ptr member variable
+         * @pre none
+         * @post decrements the ptr member variable and returns calling obj
+         * @returns modified calling obj. after ptr is decremented
+         */
+        MyIterator<T>& operator--() {--ptr; return *this;}
+
+        /*! Postfix decrement operator, decrements the pointer member var.
+         * @brief postfix decrement, decrements ptr returning its old value
+         * @pre none
+         * @post decrements the ptr member variable
+         * @returns copy of the calling obj. from before the decrement
+         */
+        MyIterator<T> operator--(int)
+            {MyIterator<T> old(*this); --ptr; return old;}
+
+        /*! addition assignment, moves the iterator n elements forward
+         * @brief addition assign., advances ptr by n elements
+         * @pre none
+         * @param[in] n amount of elements to advance by, may be negative
+         * @post ptr += n
+         * @returns the modified calling object
+         */
+        MyIterator<T>& operator+=(const difference_type n)
+            {ptr += n; return *this;}
+
+        /*! subtraction assignment, moves the iterator n elements back
+         * @brief subtraction assign., moves ptr back by n elements
+         * @pre none
+         * @param[in] n amount of elements to move back by, may be negative
+         * @post ptr -= n
+         * @returns the modified calling object
+         */
+        MyIterator<T>& operator-=(const difference_type n)
+            {ptr -= n; return *this;}
+
+        /*! addition operator, returns iterator n elements forward
+         * @brief addition, returns iterator n elements after this one
+         * @pre none
+         * @param[in] n amount of elements to advance by, may be negative
+         * @post none
+         * @returns new iterator at ptr + n
+         */
+        MyIterator<T> operator+(const difference_type n) const
+            {return MyIterator<T>(ptr + n);}
+
+        /*! subtraction operator, returns iterator n elements back
+         * @brief subtraction, returns iterator n elements before this one
+         * @pre none
+         * @param[in] n amount of elements to move back by, may be negative
+         * @post none
+         * @returns new iterator at ptr - n
+         */
+        MyIterator<T> operator-(const difference_type n) const
+            {return MyIterator<T>(ptr - n);}
+
+        /*! addition operator, returns iterator n elements after it
+         * @brief addition, returns iterator n elements after it
+         * @pre none
+         * @param[in] n amount of elements to advance by, may be negative
+         * @param[in] it iterator to advance from
+         * @post none
+         * @returns new iterator at it + n
+         */
+        friend MyIterator<T> operator+(const difference_type n,
+            const MyIterator<T> &it)
+            {return it + n;}
+
+    private:
+        T *ptr; //! pointer object to do iteration with
+};
+
+/*! subtraction operator, returns the distance between two iterators
+ * @brief subtraction, returns amount of elements from r to l
+ * @pre l and r must iterate over the same elements
+ * @param[in] l iterator to measure to
+ * @param[in] r iterator to measure from
+ * @post none
+ * @returns l.base() - r.base()
+ */
+template <typename T, typename U>
+std::ptrdiff_t operator-(const MyIterator<T> &l, const MyIterator<U> &r)
+{
+    return l.base() - r.base();
+}
+
+/*! Equal comparison operator, returns true if pointers are equal
+ * @brief Equal comp. operator, returns true if pointers are equal
+ * @pre none
+ * @param[in] l MyIterator object to compare
+ * @param[in] r MyIterator object to compare, either may be const
+ * @post none
+ * @returns true if l and r point at the same element
+ */
+template <typename T, typename U>
+bool operator==(const MyIterator<T> &l, const MyIterator<U> &r)
+{
+    return l.base() == r.base();
+}
+
+/*! Not comparison operator, returns true if pointers are not equal
+ * @brief Not comp. operator, returns true if pointers are not equal
+ * @pre none
+ * @param[in] l MyIterator object to compare
+ * @param[in] r MyIterator object to compare, either may be const
+ * @post none
+ * @returns true if l and r point at different elements
+ */
+template <typename T, typename U>
+bool operator!=(const MyIterator<T> &l, const MyIterator<U> &r)
+{
+    return l.base() != r.base();
+}
+
+/*! Less comparison operator, returns true if l comes before r
+ * @brief Less comp. operator, returns true if l is before r
+ * @pre l and r must iterate over the same elements
+ * @param[in] l MyIterator object to compare
+ * @param[in] r MyIterator object to compare, either may be const
+ * @post none
+ * @returns true if l points at an earlier element than r
+ */
+template <typename T, typename U>
+bool operator<(const MyIterator<T> &l, const MyIterator<U> &r)
+{
+    return l.base() < r.base();
+}
+
+/*! Greater comparison operator, returns true if l comes after r
+ * @brief Greater comp. operator, returns true if l is after r
+ * @pre l and r must iterate over the same elements
+ * @param[in] l MyIterator object to compare
+ * @param[in] r MyIterator object to compare, either may be const
+ * @post none
+ * @returns true if l points at a later element than r
+ */
+template <typename T, typename U>
+bool operator>(const MyIterator<T> &l, const MyIterator<U> &r)
+{
+    return r < l;
+}
+
+/*! Less or equal comparison operator, returns true if l is not after r
+ * @brief Less or equal comp. operator, returns true if l is not after r
+ * @pre l and r must iterate over the same elements
+ * @param[in] l MyIterator object to compare
+ * @param[in] r MyIterator object to compare, either may be const
+ * @post none
+ * @returns true if l points at the same or an earlier element than r
+ */
+template <typename T, typename U>
+bool operator<=(const MyIterator<T> &l, const MyIterator<U> &r)
+{
+    return !(r < l);
+}
+
+/*! Greater or equal comparison operator, returns true if l is not before r
+ * @brief Greater or equal comp. operator, returns true if l is not before r
+ * @pre l and r must iterate over the same elements
+ * @param[in] l MyIterator object to compare
+ * @param[in] r MyIterator object to compare, either may be const
+ * @post none
+ * @returns true if l points at the same or a later element than r
+ */
+template <typename T, typename U>
+bool operator>=(const MyIterator<T> &l, const MyIterator<U> &r)
+{
+    return !(l < r);
+}
+
+#endif
@@ -0,0 +1,206 @@
+#ifndef MY_LU_DECOMP_H
+#define MY_LU_DECOMP_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include "MyNumVector.h"
+#include "MyGemm.h"
+
+/*! blocked lu decomposition shared by the heatmap and quantum models
+ *
+ * included at the end of a model's MyMatrix.h, so the MyVector and
+ * MyMatrix it takes and returns are that model's. the factors live in one
+ * row-major buffer of its own, whichever way the model's matrix keeps its
+ * rows, so the trailing update is always a single gemm.
+ */
+
+/*! columns factored per panel of the blocked LU, the rest of the matrix is
+ *  updated once per panel with a single gemm
+ */
+const size_t LU_BLOCK = 64;
+
+/*! lu decomposition class, PA = LU with partial pivoting
+ * @brief MyLUDecomp class, factors a square matrix for solves and inverse
+ */
+template <typename T>
+class MyLUDecomp;
+
+/*! swap function, swaps contents of a and b
+ * @brief swap function, swaps contents of a and b
+ * @pre none
+ * @param[in,out] a lu decomposition, lhs of the swap function
+ * @param[in,out] b lu decomposition, rhs of the swap function
+ * @post swaps the factors, pivots and sign of a and b
+ */
+template <typename T>
+void swap(MyLUDecomp<T> &a, MyLUDecomp<T> &b) noexcept;
+
+/*! lu decomposition class, PA = LU with partial pivoting
+ * @brief MyLUDecomp class, factors a square matrix A as PA = LU, L unit
+ *        lower triangular and U upper triangular, both kept in one matrix;
+ *        the factors answer solves, inverse and determinant in bounded time
+ */
+template <typename T>
+class MyLUDecomp
+{
+    private:
+        MyNumVector<T> lu; //! U on and above the diagonal, L (unit) below
+        size_t n; //! rows (and cols) of A, row i of lu starts at i * n
+        MyVector<size_t> pivot; //! row of A that ended up as row i of PA
+        int sign; //! +1 or -1, determinant of the permutation P
+        bool singular; //! true if some pivot was exactly zero
+
+        /*! factor panel function, factors one block of columns
+         * @brief factor panel helper, unblocked LU of columns [k, k + nb)
+         * @pre columns left of k are already factored
+         * @param[in] k first column of the panel
+         * @param[in] nb amount of columns in the panel
+         * @post picks the largest pivot of every panel column, swaps whole
+         *       rows, and eliminates below the pivot within the panel only
+         */
+        void factor_panel(const size_t k, const size_t nb);
+
+        /*! update trailing function, applies a factored panel to the rest
+         * @brief update trailing helper, U12 = L11^-1 A12, A22 -= L21 U12
+         * @pre the panel of columns [k, k + nb) is factored
+         * @param[in] k first column of the panel
+         * @param[in] nb amount of columns in the panel
+         * @post solves for the block row of U right of the panel, then
+         *       updates the trailing matrix with one (parallel) gemm
+         */
+        void update_trailing(const size_t k, const size_t nb);
+
+    public:
+        /*! default constructor, creates an empty decomposition
+         * @brief default constructor, creates decomposition of 0x0 matrix
+         * @pre none
+         * @post creates empty decomposition of size 0
+         */
+        MyLUDecomp(): lu(), n(0), pivot(), sign(1), singular(false) {}
+
+        /*! Parameterized constructor, factors existing square matrix m
+         * @brief param. constructor, factors square matrix m
+         * @pre m must be square
+         * @param[in] m matrix to be factored
+         * @throw std::invalid_argument if m is not square
+         * @post stores the factors of PA = LU, see factorize()
+         */
+        explicit MyLUDecomp(const MyMatrix<T> &m): lu(), n(0), pivot(),
+            sign(1), singular(false) { factorize(m); }
+
+        /*! copy constructor, given existing decomposition lud
+         * @brief copy constructor, creates decomposition identical to lud
+         * @pre none
+         * @param[in] lud decomposition to be copied
+         * @post creates decomposition with copy of lud's factors and pivots
+         */
+        MyLUDecomp(const MyLUDecomp<T> &lud): lu(lud.lu), n(lud.n),
+            pivot(lud.pivot), sign(lud.sign), singular(lud.singular) {}
+
+        /*! assignment operator, returns calling object after copied from lud
+         * @brief assignment operator, copies lud and returns calling obj.
+         * @pre none
+         * @param[in] lud copy of decomposition to swap contents with
+         * @post swaps contents of calling object and the copy lud
+         * @returns the modified calling object
+         */
+        MyLUDecomp<T>& operator=(MyLUDecomp<T> lud);
+
+        /*! factorize function, replaces the stored factors with those of m
+         * @brief factorize function, computes PA = LU of square matrix m
+         * @pre m must be square
+         * @param[in] m matrix to be factored
+         * @throw std::invalid_argument if m is not square
+         * @post factors m by blocked right-looking LU with partial pivoting
+         *       in O(n^3) time; a matrix with an exactly zero pivot is still
+         *       factored, but marked singular
+         */
+        void factorize(const MyMatrix<T> &m);
+
+        /*! solve function, solves Ax = b with the stored factors
+         * @brief solve function, solves Ax = b by two substitutions
+         * @pre b must have size() elements, A must not be singular
+         * @param[in] b rhs of linear system Ax = b
+         * @throw std::invalid_argument if b is the wrong size or A singular
+         * @post permutes b, then forward substitutes with L and back
+         *       substitutes with U in O(n^2) time
+         * @returns the solution x
+         */
+        MyVector<T> solve(const MyVector<T> &b) const;
+
+        /*! solve function, solves AX = B for every column of B at once
+         * @brief solve function, solves AX = B for many rhs at once
+         * @pre B must have size() rows, A must not be singular
+         * @param[in] B matrix whose columns are the b vectors of Ax = b
+         * @throw std::invalid_argument if B has wrong rows or A singular
+         * @post substitutes whole (contiguous) rows of X at a time, so every
+         *       entry of L and U is read once for all columns together
+         * @returns a matrix whose column k is the solution for column k of B
+         */
+        MyMatrix<T> solve(const MyMatrix<T> &B) const;
+
+        /*! inverse function, returns the inverse of the factored matrix
+         * @brief inverse function, solves AX = I
+         * @pre A must not be singular
+         * @throw std::invalid_argument if A is singular
+         * @post solves for every column of the identity in one solve
+         * @returns the inverse of A
+         */
+        MyMatrix<T> inverse() const;
+
+        /*! determinant function, returns the determinant of factored matrix
+         * @brief determinant function, product of the pivots times sign(P)
+         * @pre none
+         * @post multiplies the diagonal of U, O(n)
+         * @returns the determinant of A, zero if A is singular
+         */
+        T determinant() const;
+
+        /*! singular function, returns if a pivot was exactly zero
+         * @brief singular function, returns if the matrix has no inverse
+         * @pre none
+         * @post none
+         * @returns true if A is singular
+         */
+        bool is_singular() const { return singular; }
+
+        /*! size function, returns the amount of rows of the factored matrix
+         * @brief size function, returns rows (and cols) of factored matrix
+         * @pre none
+         * @post none
+         * @returns the amount of rows of A
+         */
+        size_t size() const { return n; }
+
+        /*! factors function, returns the combined L and U factors
+         * @brief factors function, returns L (below diagonal) and U together
+         * @pre none
+         * @post copies the factors into a new matrix, O(n^2)
+         * @returns matrix with U on and above the diagonal and the
+         *          multipliers of L (whose diagonal is one) below it
+         */
+        MyMatrix<T> factors() const;
+
+        /*! pivots function, returns the row permutation
+         * @brief pivots function, returns row of A for every row of PA
+         * @pre none
+         * @post none
+         * @returns vector whose entry i is the row of A moved to row i
+         */
+        const MyVector<size_t>& pivots() const { return pivot; }
+
+        /*! swap function, swaps contents of a and b
+         * @brief swap function, swaps contents of a and b
+         * @pre none
+         * @param[in,out] a lu decomposition, lhs of the swap function
+         * @param[in,out] b lu decomposition, rhs of the swap function
+         * @post swaps the factors, pivots and sign of a and b
+         */
+        friend void swap<T>(MyLUDecomp<T> &a, MyLUDecomp<T> &b) noexcept;
+};
+
+#include "MyLUDecomp.hpp"
+
+#endif
@@ -0,0 +1,237 @@
+template <typename T>
+void swap(MyLUDecomp<T> &a, MyLUDecomp<T> &b) noexcept
+{
+    swap(a.lu, b.lu);
+    std::swap(a.n, b.n);
+    swap(a.pivot, b.pivot);
+    std::swap(a.sign, b.sign);
+    std::swap(a.singular, b.singular);
+}
+
+template <typename T>
+MyLUDecomp<T>& MyLUDecomp<T>::operator=(MyLUDecomp<T> lud)
+{
+    swap(*this, lud);
+    return *this;
+}
+
+template <typename T>
+void MyLUDecomp<T>::factorize(const MyMatrix<T> &m)
+{
+    if(m.rows() != m.cols())
+        throw std::invalid_argument("lu decomposition given non-square matrix");
+
+    // rows are copied into one buffer, so the factors have a stride whatever
+    // the layout of m
+    MyNumVector<T> factored(m.rows() * m.rows());
+    for(size_t i = 0; i < m.rows(); i++)
+        std::copy(m.row_ptr(i), m.row_ptr(i) + m.cols(),
+            factored.data() + i * m.rows());
+    swap(lu, factored);
+    n = m.rows();
+    MyVector<size_t> rows(n);
+    for(size_t i = 0; i < n; i++)
+        rows[i] = i;
+    swap(pivot, rows);
+    sign = 1;
+    singular = false;
+
+    for(size_t k = 0; k < n; k += LU_BLOCK)
+    {
+        const size_t nb = std::min(LU_BLOCK, n - k);
+        factor_panel(k, nb);
+        if(k + nb < n)
+            update_trailing(k, nb);
+    }
+}
+
+template <typename T>
+void MyLUDecomp<T>::factor_panel(const size_t k, const size_t nb)
+{
+    const size_t ld = n;
+    T *a = lu.data();
+    for(size_t j = k; j < k + nb; j++)
+    {
+        size_t p = j;
+        for(size_t i = j + 1; i < n; i++)
+        {
+            if(std::abs(a[i * ld + j]) > std::abs(a[p * ld + j]))
+                p = i;
+        }
+        if(a[p * ld + j] == T(0))
+        {
+            // nothing to eliminate with, the column is already zero below
+            // the diagonal so the factors stay valid, only the inverse is gone
+            singular = true;
+            continue;
+        }
+        if(p != j)
+        {
+            // whole rows are swapped, so L left of the panel is permuted too
+            std::swap_ranges(a + j * ld, a + j * ld + n, a + p * ld);
+            std::swap(pivot[j], pivot[p]);
+            sign = -sign;
+        }
+
+        const T *pivot_row = a + j * ld;
+        parallel_for(n - j - 1, nb, [&](const size_t lo, const size_t hi)
+        {
+            for(size_t i = j + 1 + lo; i < j + 1 + hi; i++)
+            {
+                T *row = a + i * ld;
+                row[j] /= pivot_row[j];
+                const T l = row[j];
+                for(size_t col = j + 1; col < k + nb; col++)
+                    row[col] -= l * pivot_row[col];
+            }
+        });
+    }
+}
+
+template <typename T>
+void MyLUDecomp<T>::update_trailing(const size_t k, const size_t nb)
+{
+    const size_t ld = n;
+    const size_t e = k + nb;
+    const size_t rest = n - e;
+    T *a = lu.data();
+
+    // U12 = L11^-1 A12, row by row; pieces own disjoint columns of A12
+    parallel_for(rest, nb * nb, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = k + 1; i < e; i++)
+        {
+            T *row = a + i * ld + e;
+            for(size_t p = k; p < i; p++)
+            {
+                const T l = a[i * ld + p];
+                const T *u_row = a + p * ld + e;
+                for(size_t col = lo; col < hi; col++)
+                    row[col] -= l * u_row[col];
+            }
+        }
+    });
+
+    // gemm only adds, so A22 -= L21 U12 is done as A22 += (-L21) U12
+    MyNumVector<T> neg_l21(rest * nb);
+    for(size_t i = 0; i < rest; i++)
+    {
+        const T *l_row = a + (e + i) * ld + k;
+        T *neg_row = neg_l21.data() + i * nb;
+        for(size_t p = 0; p < nb; p++)
+            neg_row[p] = -l_row[p];
+    }
+    gemm(rest, rest, nb, neg_l21.data(), nb, a + k * ld + e, ld,
+        a + e * ld + e, ld);
+}
+
+template <typename T>
+MyVector<T> MyLUDecomp<T>::solve(const MyVector<T> &b) const
+{
+    if(b.size() != size())
+        throw std::invalid_argument("lu solve given rhs of wrong size");
+    if(singular)
+        throw std::invalid_argument("lu solve given singular matrix");
+
+    const size_t ld = n;
+    const T *a = lu.data();
+    MyVector<T> x(n);
+    for(size_t i = 0; i < n; i++)
+        x[i] = b[pivot[i]];
+
+    for(size_t i = 0; i < n; i++)
+    {
+        T sum = x[i];
+        for(size_t j = 0; j < i; j++)
+            sum -= a[i * ld + j] * x[j];
+        x[i] = sum;
+    }
+    for(size_t i = n; i-- > 0;)
+    {
+        T sum = x[i];
+        for(size_t j = i + 1; j < n; j++)
+            sum -= a[i * ld + j] * x[j];
+        x[i] = sum / a[i * ld + i];
+    }
+    return x;
+}
+
+template <typename T>
+MyMatrix<T> MyLUDecomp<T>::solve(const MyMatrix<T> &B) const
+{
+    if(B.rows() != size())
+        throw std::invalid_argument("lu solve given rhs of wrong size");
+    if(singular)
+        throw std::invalid_argument("lu solve given singular matrix");
+
+    const size_t cols = B.cols();
+    const size_t ld = n;
+    const T *a = lu.data();
+    MyMatrix<T> X(n, cols);
+    for(size_t i = 0; i < n; i++)
+    {
+        const T *b_row = B.row_ptr(pivot[i]);
+        std::copy(b_row, b_row + cols, X.row_ptr(i));
+    }
+
+    // columns of X are independent systems, so pieces own bands of columns
+    parallel_for(cols, n * n, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            T *row = X.row_ptr(i);
+            for(size_t j = 0; j < i; j++)
+            {
+                const T l = a[i * ld + j];
+                const T *x_row = X.row_ptr(j);
+                for(size_t col = lo; col < hi; col++)
+                    row[col] -= l * x_row[col];
+            }
+        }
+        for(size_t i = n; i-- > 0;)
+        {
+            T *row = X.row_ptr(i);
+            for(size_t j = i + 1; j < n; j++)
+            {
+                const T u = a[i * ld + j];
+                const T *x_row = X.row_ptr(j);
+                for(size_t col = lo; col < hi; col++)
+                    row[col] -= u * x_row[col];
+            }
+            const T diag = a[i * ld + i];
+            for(size_t col = lo; col < hi; col++)
+                row[col] /= diag;
+        }
+    });
+    return X;
+}
+
+template <typename T>
+MyMatrix<T> MyLUDecomp<T>::inverse() const
+{
+    if(singular)
+        throw std::invalid_argument("lu inverse given singular matrix");
+    if(size() == 0)
+        return MyMatrix<T>();
+    return solve(MyMatrix<T>(n, n).identity());
+}
+
+template <typename T>
+T MyLUDecomp<T>::determinant() const
+{
+    if(singular)
+        return T(0);
+    T det = T(sign);
+    for(size_t i = 0; i < size(); i++)
+        det *= lu[i * n + i];
+    return det;
+}
+
+template <typename T>
+MyMatrix<T> MyLUDecomp<T>::factors() const
+{
+    MyMatrix<T> f(n, n);
+    for(size_t i = 0; i < n; i++)
+        std::copy(lu.data() + i * n, lu.data() + (i + 1) * n, f.row_ptr(i));
+    return f;
+}
@@ -0,0 +1,539 @@
+#ifndef MY_NUM_VECTOR_H
+#define MY_NUM_VECTOR_H
+
+#include <iostream>
+#include <string>
+#include <limits>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <type_traits>
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <stdexcept>
+#include <initializer_list>
+#include "MyAllocator.h"
+#include "MyBoundsCheck.h"
+#include "MyIterator.h"
+
+using std::ostream;
+using std::istream;
+
+/*! numeric vector shared by every model
+ *
+ * the heatmap and quantum MyVector keep their elements in one, and the
+ * glucose monitor (GIVector) and SIRD model (SIRDVector) use it directly.
+ * up to N elements live inside the object itself, so the 2-6 element
+ * parameter and coefficient vectors of the models never touch the heap;
+ * longer vectors move to MY_ALIGNMENT aligned storage that grows
+ * geometrically, so growing one element at a time is amortized O(1).
+ */
+
+/*! elements a MyNumVector holds without allocating, enough for the
+ *  constants, coefficients and control values of the ode models
+ */
+const size_t NUM_VECTOR_INLINE = 6;
+
+template <typename T, size_t N = NUM_VECTOR_INLINE>
+class MyNumVector;
+
+/*! Overloaded output, output contents of MyNumVector
+ * @brief output operator to output contents of MyNumVector to console
+ * @pre type T must be capable of outputting to console
+ * @param[in,out] out ostream object to perform outputting with
+ * @param[in] src MyNumVector to be outputted to the console
+ * @post outputs the elements of src separated by spaces
+ * @returns the modified ostream object
+ */
+template <typename T, size_t N>
+ostream& operator<<(ostream &out, const MyNumVector<T, N> &src);
+
+/*! Overloaded insertion, fill contents of MyNumVector with input
+ * @brief insertion operator to fill contents of MyNumVector with input
+ * @pre none
+ * @param[in,out] in istream object to perform inputting with
+ * @param[in] src MyNumVector to be inputted with data
+ * @post replaces the contents of src by every T read until in ends or a
+ *       value fails to parse; integer and floating point values are
+ *       parsed straight from the stream buffer of in, anything else is
+ *       read one value at a time
+ * @returns the modified istream object
+ */
+template <typename T, size_t N>
+istream& operator>>(istream &in, MyNumVector<T, N> &src);
+
+/*! parse number function, parses one T from a C string like strtod
+ * @brief parse number, reads the number starting at p
+ * @pre T is an integer or floating point type, p is null terminated
+ * @param[in] p first character of the number, leading whitespace skipped
+ * @param[out] end set to one past the last character parsed, or to p
+ *             if no number could be parsed
+ * @param[out] val the parsed number
+ * @post parses with strtoll/strtoull/strtof/strtod/strtold, an unsigned
+ *       -n as n negated in T, as operator>> does
+ * @returns false if nothing was parsed or the value does not fit in T
+ */
+template <typename T>
+bool parse_number(const char *p, char **end, T &val);
+
+/*! scan decimal function, takes the characters of one number from sb
+ * @brief scan decimal, takes the longest run of sb that can be a number
+ * @pre none
+ * @param[in,out] sb stream buffer to take the characters from
+ * @param[out] token the characters taken
+ * @param[in] floating true to also take a decimal point and an exponent
+ * @post takes a sign, digits and, if floating, one '.' and one exponent
+ *       with its own sign, the characters operator>> takes for a number;
+ *       the first character that does not fit stays in sb
+ * @returns true if sb ran out of characters
+ */
+inline bool scan_decimal(std::streambuf *sb, std::string &token,
+    const bool floating);
+
+/*! bulk read function, appends every number of in to src
+ * @brief bulk read, parses numbers straight from the buffer of in
+ * @pre T is an integer or floating point type
+ * @param[in,out] in istream object to read from
+ * @param[in,out] src vector to append the numbers to
+ * @post reads the characters of each number from the stream buffer of in
+ *       (see scan_decimal) and parses them, without a formatted
+ *       extraction per number; stops at the end of in, setting eofbit
+ *       and failbit, or at the first number that fails to parse, setting
+ *       failbit and leaving in right where operator>> of T would have
+ *       stopped, so hex, inf and nan are rejected like operator>> does
+ */
+template <typename T, size_t N>
+void read_numbers(istream &in, MyNumVector<T, N> &src, std::true_type);
+
+/*! read function, appends every T of in to src
+ * @brief read, reads values one at a time with operator>> of T
+ * @pre T must be capable of inputting from an istream
+ * @param[in,out] in istream object to read from
+ * @param[in,out] src vector to append the values to
+ * @post reads until in ends or a value fails to read
+ */
+template <typename T, size_t N>
+void read_numbers(istream &in, MyNumVector<T, N> &src, std::false_type);
+
+/*! swap function, swaps contents of a and b vector with each other
+ * @brief swap function, swaps contents of a and b with each other
+ * @pre none
+ * @param[in,out] a vector object to be switched with 'b'
+ * @param[in,out] b vector object to be switched with 'a'
+ * @post swaps the contents of 'a' and 'b', only exchanging pointers when
+ *       both are on the heap
+ */
+template <typename T, size_t N>
+void swap(MyNumVector<T, N> &a, MyNumVector<T, N> &b) noexcept;
+
+/*! addition operator, for all element add by a's corresponding element
+ * @brief addition, for all elements add by a's corresponding element
+ * @pre a must be of same size as b, T must support addition
+ * @param[in] a vector of same size as b to add with
+ * @param[in] b vector of same size as a to add with
+ * @throw std::invalid_argument if a is not same size as b
+ * @post for each element in both vectors, a[i] + b[i]
+ * @returns the new MyNumVector after all addition is completed
+ */
+template <typename T, size_t N>
+MyNumVector<T, N> operator+(const MyNumVector<T, N> &a,
+    const MyNumVector<T, N> &b);
+
+/*! subtract operator, for all element minus by a's corresponding element
+ * @brief subtraction, for all elements minus by a's corresponding element
+ * @pre a must be of same size as b, T must support subtraction
+ * @param[in] a vector of same size as b to subtract with
+ * @param[in] b vector of same size as a to subtract with
+ * @throw std::invalid_argument if a is not same size as b
+ * @post for each element in both vectors, a[i] - b[i]
+ * @returns the new MyNumVector after all subtraction is completed
+ */
+template <typename T, size_t N>
+MyNumVector<T, N> operator-(const MyNumVector<T, N> &a,
+    const MyNumVector<T, N> &b);
+
+/*! multiplication operator, multiply all elements of lhs by rhs
+ * @brief scalar mult., multiply all elements of lhs by rhs
+ * @pre T must be of type that supports multiplication
+ * @param[in] lhs a MyNumVector object w/ elements to be multiplied
+ * @param[in] rhs a scalar value of type T to multiply with
+ * @post multiplies all elements of lhs by a scalar rhs
+ * @returns new MyNumVector after multiplication performed
+ */
+template <typename T, size_t N>
+MyNumVector<T, N> operator*(const MyNumVector<T, N> &lhs, const T &rhs);
+
+/*! multiplication operator, multiply all elements of rhs by lhs
+ * @brief scalar mult., multiply all elements of rhs by lhs
+ * @pre T must be of type that supports multiplication
+ * @param[in] lhs a scalar value of type T to multiply with
+ * @param[in] rhs a MyNumVector object w/ elements to be multiplied
+ * @post multiplies all elements of rhs by a scalar lhs
+ * @returns new MyNumVector after multiplication performed
+ */
+template <typename T, size_t N>
+MyNumVector<T, N> operator*(const T lhs, const MyNumVector<T, N> &rhs);
+
+/*! dot product operator, compute dot product of lhs and rhs
+ * @brief dot product, computes dot product of lhs and rhs
+ * @pre lhs must be of same size as rhs, T must support multiplication
+ * @param[in] lhs a MyNumVector to compute dot product with
+ * @param[in] rhs a MyNumVector to compute dot product with
+ * @throw std::invalid_argument if lhs is not same size as rhs
+ * @post adds product of all corresponding elements and returns num
+ * @returns the dot product of lhs and rhs
+ */
+template <typename T, size_t N>
+T operator*(const MyNumVector<T, N> &lhs, const MyNumVector<T, N> &rhs);
+
+/*! Numerical exponentiation, compute x^n via squaring method
+ * @brief computes x^n via squaring numerical exponentiation method
+ * @param[in] x the base of the exponential to evaluate
+ * @param[in] n the exponent of the exponential to evaluate (integer)
+ * @post computes x^n via squaring method of numerical methods
+ * @returns the computed x^n value
+ */
+template <typename T>
+T exp_by_squaring(const T x, const int n);
+
+/*! Newton's method for nth root, calculates x^(1/n)
+ * @brief uses newton's method to compute and return x^(1/n)
+ * @pre n must not equal 0
+ * @param[in] x the base of the nth root to evaluate
+ * @param[in] n the denominator of the exponent (1/n) to raise x to
+ * @post computes the nth root of x with ten newton iterations
+ * @returns the computed nth root of x
+ */
+template <typename T>
+T sqrt_newton(const T x, const int n);
+
+/*! MyNumVector class
+ * @brief numeric vector with small-buffer storage, aligned heap storage
+ *        and geometric growth; T must be default constructible
+ */
+template <typename T, size_t N>
+class MyNumVector
+{
+    private:
+        T *m_data; //! m_inline, or aligned heap array of m_capacity T's
+        size_t m_size; //! amount of elements in use
+        size_t m_capacity; //! amount of elements m_data has room for
+        T m_inline[N]; //! in-object storage, used while m_size <= N
+
+        /*! inline function, returns if the elements live in the object
+         * @brief inline function, returns if m_data points at m_inline
+         * @pre none
+         * @post none
+         * @returns true if no heap storage is owned
+         */
+        bool is_inline() const { return m_data == m_inline; }
+
+        /*! grow function, moves the elements to larger heap storage
+         * @brief grow helper, reallocates to at least min_capacity elements
+         * @pre min_capacity > m_capacity
+         * @param[in] min_capacity least amount of elements to make room for
+         * @post at least doubles the capacity, moves the m_size elements
+         *       into the new aligned storage and frees the old storage
+         */
+        void grow(const size_t min_capacity);
+
+        /*! take function, takes over the contents of src
+         * @brief take helper, moves src's contents into empty calling obj.
+         * @pre the calling object must be empty and inline
+         * @param[in,out] src vector whose contents are taken over
+         * @post steals src's heap storage, or moves its inline elements;
+         *       leaves src empty and inline
+         */
+        void take(MyNumVector<T, N> &src) noexcept;
+
+    public:
+        typedef T value_type;
+        typedef MyIterator<T> iterator; //! mutable contiguous iterator
+        typedef MyIterator<const T> const_iterator; //! read-only iterator
+
+        /*! Default constructor, defaults to 0 vector with m_size 0
+         * @brief Default constructor making zero vector with size of 0
+         * @pre none
+         * @post creates empty vector, using its inline storage
+         */
+        MyNumVector(): m_data(m_inline), m_size(0), m_capacity(N) {}
+
+        /*! Parameterized constructor, given initializer_list 'l'
+         * @brief Parameterized constructor given initializer_list 'l'
+         * @pre none
+         * @param[in] l initializer list of T elements to copy to vector
+         * @post creates a MyNumVector obj holding the elements of 'l'
+         */
+        MyNumVector(const std::initializer_list<T> &l);
+
+        /*! Parameterized constructor, given size of MyNumVector 'space'
+         * @brief Parameterized constructor, given size of vector 'space'
+         * @pre none
+         * @param[in] space size_t representing size of MyNumVector
+         * @post creates a MyNumVector of 'space' value-initialized elements
+         */
+        explicit MyNumVector(const size_t space);
+
+        /*! Parameterized constructor, given arr of values of size n
+         * @brief Parameterized constructor, given arr of values of size n
+         * @pre arr must hold at least n elements
+         * @param[in] arr array of values to copy to MyNumVector
+         * @param[in] n value to initialize as size of MyNumVector
+         * @post creates a MyNumVector with values of arr and equal size
+         */
+        MyNumVector(const T *arr, const size_t n);
+
+        /*! Destructor, clears memory allocated to heap storage
+         * @brief Destructor, frees the heap storage, if any
+         * @pre none
+         * @post frees the aligned heap storage when the vector has one
+         */
+        ~MyNumVector();
+
+        /*! Copy constructor
+         * @brief Copy constructor, creates identical MyNumVector to src
+         * @pre template type T must support assignment
+         * @param[in] src the object to be copied to calling object
+         * @post creates MyNumVector with a copy of src's elements, inline if
+         *       they fit
+         */
+        MyNumVector(const MyNumVector<T, N> &src);
+
+        /*! Move constructor
+         * @brief Move constructor, takes over the contents of src
+         * @pre none
+         * @param[in,out] src the object whose contents are taken over
+         * @post steals src's heap storage (or moves its few inline
+         *       elements), leaves src empty
+         */
+        MyNumVector(MyNumVector<T, N> &&src) noexcept: m_data(m_inline),
+            m_size(0), m_capacity(N) { take(src); }
+
+        /*! Assignment operator, returns MyNumVector equal to given src
+         * @brief Assignment operator, returns MyNumVector equal to src
+         * @pre template type T must support assignment
+         * @param[in] src copy of src vector to swap contents with, moved
+         *            (not copied) into when assigning from a temporary
+         * @post swaps contents of calling object and src
+         * @returns the modified calling object, contains contents of src
+         */
+        MyNumVector<T, N>& operator=(MyNumVector<T, N> src);
+
+        /*! Resize function, changes MyNumVector size to new_size
+         * @brief Resize function, changes MyNumVector size to new_size
+         * @pre none
+         * @param[in] new_size size_t representing new amount of elements
+         * @post keeps the first min(size, new_size) elements, value
+         *       initializes any new ones; only reallocates when new_size
+         *       passes the capacity, and then at least doubles it
+         */
+        void resize(const size_t new_size);
+
+        /*! Reserve function, makes room for new_capacity elements
+         * @brief Reserve function, grows capacity to at least new_capacity
+         * @pre none
+         * @param[in] new_capacity amount of elements to make room for
+         * @post size and elements are unchanged; reallocates once when
+         *       new_capacity passes the capacity, so the following appends
+         *       up to new_capacity do not reallocate
+         */
+        void reserve(const size_t new_capacity);
+
+        /*! Capacity function, returns amount of elements room is made for
+         * @brief Capacity function, returns amount of elements held w/o
+         *        reallocating
+         * @pre none
+         * @post returns the capacity of MyNumVector, never less than N
+         * @returns the capacity of MyNumVector
+         */
+        size_t capacity() const { return m_capacity; }
+
+        /*! push_back function, appends a copy of val to the end
+         * @brief push_back function, appends a copy of val to the end
+         * @pre none
+         * @param[in] val element to append, may be an element of the vector
+         * @post size grows by one; amortized O(1), as a full vector at
+         *       least doubles its capacity
+         */
+        void push_back(const T &val);
+
+        /*! push_back function, moves val to the end
+         * @brief push_back function, appends val to the end by moving it
+         * @pre none
+         * @param[in,out] val element to move into the vector
+         * @post size grows by one; amortized O(1), as a full vector at
+         *       least doubles its capacity
+         */
+        void push_back(T &&val);
+
+        /*! clear function, removes all elements
+         * @brief clear function, sets size to 0 keeping the capacity
+         * @pre none
+         * @post size is 0, the storage is kept for refilling
+         */
+        void clear() { m_size = 0; }
+
+        /*! Size function, returns the size of the MyNumVector
+         * @brief Size function, returns amount of elements in MyNumVector
+         * @pre none
+         * @post returns the size of MyNumVector
+         * @returns the size of MyNumVector
+         */
+        size_t size() const { return m_size; }
+
+        /*! Data function, returns pointer to the elements
+         * @brief Data function, returns pointer to the elements
+         * @pre none
+         * @post returns pointer valid for size() elements, until the next
+         *       resize, move or swap
+         * @returns pointer to the first element
+         */
+        T* data() { return m_data; }
+
+        /*! Data function, returns pointer to the elements
+         * @brief Data function, returns read-only pointer to the elements
+         * @pre none
+         * @post returns pointer valid for size() elements, until the next
+         *       resize, move or swap
+         * @returns pointer to the first element
+         */
+        const T* data() const { return m_data; }
+
+        /*! Subscript operator, returns const ref. to element at index i
+         * @brief Subscript operator, returns const ref. to element i
+         * @pre i must be in range 0 <= i < size()
+         * @param[in] i size_t representing index of the element
+         * @throw std::out_of_range if i >= size() and BOUNDS_CHECKED
+         * @post returns a read-only reference to element i
+         * @returns the read-only reference to element i
+         */
+        const T& operator[](const size_t i) const;
+
+        /*! Subscript operator, returns ref. to element at index i
+         * @brief Subscript operator, returns reference to element i
+         * @pre i must be in range 0 <= i < size()
+         * @param[in] i size_t representing index of the element
+         * @throw std::out_of_range if i >= size() and BOUNDS_CHECKED
+         * @post returns a reference to element i
+         * @returns the reference to element i
+         */
+        T& operator[](const size_t i);
+
+        /*! apply function, applies func to all elements
+         * @brief apply function, replaces every element x by func(x)
+         * @pre function must be of form func(T) with return type T
+         * @param[in] func function of form func(T) with return type T
+         * @post applies func() to all elements, return modified obj
+         * @returns the modified vector with func() applied to all elements
+         */
+        MyNumVector<T, N>& apply(T(*func)(T));
+
+        /*! unary minus operator, makes all elements in MyNumVector negative
+         * @brief unary minus, for all elements in vector, change to inverse
+         * @pre none
+         * @post for each element in vector, change each to inverse
+         * @returns a modified vector with each element inverted
+         */
+        MyNumVector<T, N>& operator-();
+
+        /*! addition assignment, adds rhs to the vector in place
+         * @brief addition assign., for all elements add rhs's element
+         * @pre rhs must be of same size as calling obj, T must support addition
+         * @param[in] rhs vector of same size to add with
+         * @throw std::invalid_argument if rhs is not same size
+         * @post for each element, data()[i] += rhs[i], no allocation
+         * @returns the modified calling object
+         */
+        MyNumVector<T, N>& operator+=(const MyNumVector<T, N> &rhs);
+
+        /*! subtraction assignment, subtracts rhs from the vector in place
+         * @brief subtraction assign., for all elements minus rhs's element
+         * @pre rhs must be of same size as calling obj, T must support minus
+         * @param[in] rhs vector of same size to subtract with
+         * @throw std::invalid_argument if rhs is not same size
+         * @post for each element, data()[i] -= rhs[i], no allocation
+         * @returns the modified calling object
+         */
+        MyNumVector<T, N>& operator-=(const MyNumVector<T, N> &rhs);
+
+        /*! multiplication assignment, scales the vector in place
+         * @brief scalar mult. assign., multiply all elements by rhs
+         * @pre T must be of type that supports multiplication
+         * @param[in] rhs a scalar value of type T to multiply with
+         * @post for each element, data()[i] *= rhs, no allocation
+         * @returns the modified calling object
+         */
+        MyNumVector<T, N>& operator*=(const T &rhs);
+
+        /*! P-norm evaluator, calculates the p-norm of vector
+         * @brief calculates and returns p-norm of lhs of ^ operator
+         * @pre exponentiation (squaring) must be supported for template type T
+         * @param[in] p integer value to calculate norm with
+         * @post calculates the p-norm of calling MyNumVector
+         * @returns the calculated p-norm value (of type T)
+         */
+        T operator^(const int p) const;
+
+        /*! begin() function, returns iter at beginning of the vector
+         * @brief begin() function, returns iter at beginning of the vector
+         * @pre none
+         * @post returns an iterator to beginning of the vector
+         * @returns a mutable iterator to beginning of the vector
+         */
+        iterator begin() { return iterator(m_data); }
+
+        /*! begin() function, returns read-only iter at beginning of the vector
+         * @brief begin() function, returns const iter at start of the vector
+         * @pre none
+         * @post returns a read-only iterator to beginning of the vector
+         * @returns a const iterator to beginning of the vector
+         */
+        const_iterator begin() const { return const_iterator(m_data); }
+
+        /*! end() function, returns iter at end of the vector
+         * @brief end() function, returns iter at end of the vector
+         * @pre none
+         * @post returns an iterator to end of the vector
+         * @returns a mutable iterator one past the end of the vector
+         */
+        iterator end() { return iterator(m_data + m_size); }
+
+        /*! end() function, returns read-only iter at end of the vector
+         * @brief end() function, returns const iter at end of the vector
+         * @pre none
+         * @post returns a read-only iterator to end of the vector
+         * @returns a const iterator one past the end of the vector
+         */
+        const_iterator end() const { return const_iterator(m_data + m_size); }
+
+        /*! cbegin() function, returns read-only iter at beginning of the vector
+         * @brief cbegin() function, const iter at beginning of the vector
+         * @pre none
+         * @post returns a read-only iterator to beginning of the vector
+         * @returns a const iterator to beginning of the vector
+         */
+        const_iterator cbegin() const { return begin(); }
+
+        /*! cend() function, returns read-only iter at end of the vector
+         * @brief cend() function, const iter at end of the vector
+         * @pre none
+         * @post returns a read-only iterator to end of the vector
+         * @returns a const iterator one past the end of the vector
+         */
+        const_iterator cend() const { return end(); }
+
+        /*! swap function, swaps contents of a and b vector with each other
+         * @brief swap function, swaps contents of a and b with each other
+         * @pre none
+         * @param[in,out] a vector object to be switched with 'b'
+         * @param[in,out] b vector object to be switched with 'a'
+         * @post swaps the contents of 'a' and 'b'
+         */
+        friend void swap<T, N>(MyNumVector<T, N> &a, MyNumVector<T, N> &b)
+            noexcept;
+};
+
+#include "MyNumVector.hpp"
+
+#endif
@@ -0,0 +1,431 @@
+template <typename T, size_t N>
+MyNumVector<T, N>::MyNumVector(const std::initializer_list<T> &l):
+    m_data(m_inline), m_size(0), m_capacity(N)
+{
+    resize(l.size());
+    std::copy(l.begin(), l.end(), m_data);
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>::MyNumVector(const size_t space): m_data(m_inline),
+    m_size(0), m_capacity(N)
+{
+    resize(space);
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>::MyNumVector(const T *arr, const size_t n):
+    m_data(m_inline), m_size(0), m_capacity(N)
+{
+    resize(n);
+    std::copy(arr, arr + n, m_data);
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>::~MyNumVector()
+{
+    if(!is_inline())
+        aligned_delete_array(m_data, m_capacity);
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>::MyNumVector(const MyNumVector<T, N> &src):
+    m_data(m_inline), m_size(0), m_capacity(N)
+{
+    resize(src.m_size);
+    std::copy(src.m_data, src.m_data + src.m_size, m_data);
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>& MyNumVector<T, N>::operator=(MyNumVector<T, N> src)
+{
+    swap(*this, src);
+    return *this;
+}
+
+template <typename T, size_t N>
+void MyNumVector<T, N>::grow(const size_t min_capacity)
+{
+    const size_t new_capacity = std::max(min_capacity, 2 * m_capacity);
+    T *fresh = aligned_new_array<T>(new_capacity);
+    std::move(m_data, m_data + m_size, fresh);
+    if(!is_inline())
+        aligned_delete_array(m_data, m_capacity);
+    m_data = fresh;
+    m_capacity = new_capacity;
+}
+
+template <typename T, size_t N>
+void MyNumVector<T, N>::take(MyNumVector<T, N> &src) noexcept
+{
+    if(src.is_inline())
+        std::move(src.m_inline, src.m_inline + src.m_size, m_inline);
+    else
+    {
+        m_data = src.m_data;
+        m_capacity = src.m_capacity;
+        src.m_data = src.m_inline;
+        src.m_capacity = N;
+    }
+    m_size = src.m_size;
+    src.m_size = 0;
+}
+
+template <typename T, size_t N>
+void MyNumVector<T, N>::resize(const size_t new_size)
+{
+    if(new_size > m_capacity)
+        grow(new_size);
+
+    // storage past m_size may hold old values from before a shrink
+    std::fill(m_data + std::min(m_size, new_size), m_data + new_size, T());
+    m_size = new_size;
+}
+
+template <typename T, size_t N>
+void MyNumVector<T, N>::reserve(const size_t new_capacity)
+{
+    if(new_capacity > m_capacity)
+        grow(new_capacity);
+}
+
+template <typename T, size_t N>
+void MyNumVector<T, N>::push_back(const T &val)
+{
+    if(m_size == m_capacity)
+    {
+        // val may live in the storage grow() is about to free
+        T copy(val);
+        grow(m_size + 1);
+        m_data[m_size++] = std::move(copy);
+        return;
+    }
+    m_data[m_size++] = val;
+}
+
+template <typename T, size_t N>
+void MyNumVector<T, N>::push_back(T &&val)
+{
+    if(m_size == m_capacity)
+        grow(m_size + 1);
+    m_data[m_size++] = std::move(val);
+}
+
+template <typename T, size_t N>
+const T& MyNumVector<T, N>::operator[](const size_t i) const
+{
+    check_index(i, m_size, "i is not in range of vector");
+    return m_data[i];
+}
+
+template <typename T, size_t N>
+T& MyNumVector<T, N>::operator[](const size_t i)
+{
+    check_index(i, m_size, "i is not in range of vector");
+    return m_data[i];
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>& MyNumVector<T, N>::apply(T(*func)(T))
+{
+    for(size_t i = 0; i < m_size; i++)
+        m_data[i] = func(m_data[i]);
+    return *this;
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>& MyNumVector<T, N>::operator-()
+{
+    for(size_t i = 0; i < m_size; i++)
+        m_data[i] *= -1;
+    return *this;
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>& MyNumVector<T, N>::operator+=(const MyNumVector<T, N> &rhs)
+{
+    if(rhs.m_size != m_size)
+        throw std::invalid_argument("lhs and rhs of += not same size");
+
+    const T *r = rhs.m_data;
+    for(size_t i = 0; i < m_size; i++)
+        m_data[i] += r[i];
+    return *this;
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>& MyNumVector<T, N>::operator-=(const MyNumVector<T, N> &rhs)
+{
+    if(rhs.m_size != m_size)
+        throw std::invalid_argument("lhs and rhs of -= not same size");
+
+    const T *r = rhs.m_data;
+    for(size_t i = 0; i < m_size; i++)
+        m_data[i] -= r[i];
+    return *this;
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N>& MyNumVector<T, N>::operator*=(const T &rhs)
+{
+    for(size_t i = 0; i < m_size; i++)
+        m_data[i] *= rhs;
+    return *this;
+}
+
+template <typename T, size_t N>
+T MyNumVector<T, N>::operator^(const int p) const
+{
+    T sum = 0;
+    for(size_t i = 0; i < m_size; i++)
+        sum += exp_by_squaring(m_data[i] < 0 ? -m_data[i] : m_data[i], p);
+    return sqrt_newton(double(sum), p);
+}
+
+template <typename T, size_t N>
+ostream& operator<<(ostream &out, const MyNumVector<T, N> &src)
+{
+    for(size_t i = 0; i + 1 < src.size(); i++)
+        out << src[i] << " ";
+    if(src.size() != 0)
+        out << src[src.size() - 1];
+    return out;
+}
+
+template <typename T>
+bool parse_number(const char *p, char **end, T &val)
+{
+    errno = 0;
+    if(std::is_signed<T>::value)
+    {
+        const long long v = std::strtoll(p, end, 10);
+        if(errno == ERANGE ||
+            v < (long long)std::numeric_limits<T>::min() ||
+            v > (long long)std::numeric_limits<T>::max())
+            return false;
+        val = T(v);
+    }
+    else
+    {
+        // like operator>>, -n reads as n negated in T, for n that fits T
+        const bool negative = (*p == '-');
+        const unsigned long long v = std::strtoull(p, end, 10);
+        const unsigned long long magnitude = negative ? 0 - v : v;
+        if(errno == ERANGE ||
+            magnitude > (unsigned long long)std::numeric_limits<T>::max())
+            return false;
+        val = negative ? T(T(0) - T(magnitude)) : T(magnitude);
+    }
+    return *end != p;
+}
+
+template <>
+inline bool parse_number<float>(const char *p, char **end, float &val)
+{
+    // only an overflow parses to inf here, which operator>> rejects
+    val = std::strtof(p, end);
+    return *end != p && val <= std::numeric_limits<float>::max() &&
+        val >= -std::numeric_limits<float>::max();
+}
+
+template <>
+inline bool parse_number<double>(const char *p, char **end, double &val)
+{
+    val = std::strtod(p, end);
+    return *end != p && val <= std::numeric_limits<double>::max() &&
+        val >= -std::numeric_limits<double>::max();
+}
+
+template <>
+inline bool parse_number<long double>(const char *p, char **end,
+    long double &val)
+{
+    val = std::strtold(p, end);
+    return *end != p && val <= std::numeric_limits<long double>::max() &&
+        val >= -std::numeric_limits<long double>::max();
+}
+
+inline bool scan_decimal(std::streambuf *sb, std::string &token,
+    const bool floating)
+{
+    typedef std::char_traits<char> traits;
+    bool digits = false, point = false, exponent = false;
+    token.clear();
+    int c = sb->sgetc();
+    for(; c != traits::eof(); c = sb->snextc())
+    {
+        const char ch = traits::to_char_type(c);
+        const bool sign = (ch == '+' || ch == '-') && (token.empty() ||
+            (exponent && (token.back() == 'e' || token.back() == 'E')));
+        if(std::isdigit((unsigned char)ch))
+            digits = true;
+        else if(floating && ch == '.' && !point && !exponent)
+            point = true;
+        else if(floating && (ch == 'e' || ch == 'E') && digits && !exponent)
+            exponent = true;
+        else if(!sign)
+            break;
+        token += ch;
+    }
+    return c == traits::eof();
+}
+
+template <typename T, size_t N>
+void read_numbers(istream &in, MyNumVector<T, N> &src, std::true_type)
+{
+    typedef std::char_traits<char> traits;
+    const istream::sentry ok(in);
+    if(!ok)
+        return;
+
+    std::streambuf *sb = in.rdbuf();
+    std::string token;
+    while(true)
+    {
+        int c = sb->sgetc();
+        while(c != traits::eof() && std::isspace(c))
+            c = sb->snextc();
+        if(c == traits::eof())
+        {
+            in.setstate(std::ios::eofbit | std::ios::failbit);
+            return;
+        }
+
+        // a token like 12abc gives 12 and then fails at abc, as repeated
+        // operator>> calls would
+        const bool at_end = scan_decimal(sb, token,
+            std::is_floating_point<T>::value);
+        char *end;
+        T val;
+        if(!parse_number(token.c_str(), &end, val) || *end != '\0')
+        {
+            in.setstate(at_end ? std::ios::eofbit | std::ios::failbit :
+                std::ios::failbit);
+            return;
+        }
+        src.push_back(val);
+        if(at_end)
+        {
+            in.setstate(std::ios::eofbit | std::ios::failbit);
+            return;
+        }
+    }
+}
+
+template <typename T, size_t N>
+void read_numbers(istream &in, MyNumVector<T, N> &src, std::false_type)
+{
+    std::istream_iterator<T> eos;
+    std::istream_iterator<T> iit(in);
+    for(; iit != eos; iit++)
+        src.push_back(*iit);
+}
+
+template <typename T, size_t N>
+istream& operator>>(istream &in, MyNumVector<T, N> &src)
+{
+    // char and bool read as single characters, not as numbers
+    typedef std::integral_constant<bool, std::is_floating_point<T>::value ||
+        (std::is_integral<T>::value && sizeof(T) > 1)> numeric;
+
+    src.clear();
+    read_numbers(in, src, numeric());
+    return in;
+}
+
+template <typename T, size_t N>
+void swap(MyNumVector<T, N> &a, MyNumVector<T, N> &b) noexcept
+{
+    if(!a.is_inline() && !b.is_inline())
+    {
+        std::swap(a.m_data, b.m_data);
+        std::swap(a.m_size, b.m_size);
+        std::swap(a.m_capacity, b.m_capacity);
+        return;
+    }
+
+    // inline elements live in the objects themselves, so they are moved
+    // through a temporary; take() leaves each source empty for the next
+    MyNumVector<T, N> temp(std::move(a));
+    a.take(b);
+    b.take(temp);
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N> operator+(const MyNumVector<T, N> &a,
+    const MyNumVector<T, N> &b)
+{
+    if(a.size() != b.size())
+        throw std::invalid_argument("lhs and rhs of + not same size");
+
+    MyNumVector<T, N> new_vect(a);
+    new_vect += b;
+    return new_vect;
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N> operator-(const MyNumVector<T, N> &a,
+    const MyNumVector<T, N> &b)
+{
+    if(a.size() != b.size())
+        throw std::invalid_argument("lhs and rhs of - not same size");
+
+    MyNumVector<T, N> new_vect(a);
+    new_vect -= b;
+    return new_vect;
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N> operator*(const MyNumVector<T, N> &lhs, const T &rhs)
+{
+    MyNumVector<T, N> new_vect(lhs);
+    new_vect *= rhs;
+    return new_vect;
+}
+
+template <typename T, size_t N>
+MyNumVector<T, N> operator*(const T lhs, const MyNumVector<T, N> &rhs)
+{
+    return (rhs * lhs);
+}
+
+template <typename T, size_t N>
+T operator*(const MyNumVector<T, N> &lhs, const MyNumVector<T, N> &rhs)
+{
+    if(lhs.size() != rhs.size())
+        throw std::invalid_argument("lhs and rhs for * not of same size");
+
+    const T *l = lhs.data();
+    const T *r = rhs.data();
+    T sum = 0;
+    for(size_t i = 0; i < lhs.size(); i++)
+        sum += (l[i] * r[i]);
+    return sum;
+}
+
+template <typename T>
+T exp_by_squaring(const T x, const int n)
+{
+    if(n < 0)
+        return exp_by_squaring(1.0 / x, -n);
+    else if(n == 0)
+        return 1;
+    else if(n == 1)
+        return x;
+    else if(n % 2 == 0)
+        return exp_by_squaring(x * x, n / 2);
+    return x * exp_by_squaring(x * x, (n - 1) / 2);
+}
+
+template <typename T>
+T sqrt_newton(const T x, const int n)
+{
+    T xn = x;
+    T xn_next;
+    for(int i = 0; i < 10; i++)
+    {
+        xn_next = (1.0/n) * ((n-1)*xn + (x/exp_by_squaring(xn, n-1)));
+        xn = xn_next;
+    }
+    return xn_next;
+}
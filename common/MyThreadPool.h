@@ -0,0 +1,374 @@
+#ifndef MY_THREAD_POOL_H
+#define MY_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*! work (roughly element operations) a container operation must have before
+ *  it is split across threads, and the size of every piece it is split into
+ */
+const size_t PARALLEL_MIN_WORK = 1 << 15;
+
+/*! thread pool class, fixed set of workers that share work by stealing
+ * @brief MyThreadPool class, work-stealing pool running parallel_for ranges
+ */
+class MyThreadPool
+{
+    private:
+        /*! run queue of one worker, the owner takes tasks from the back and
+         *  other threads steal from the front
+         */
+        struct Queue
+        {
+            std::mutex lock; //! guards tasks
+            std::deque<std::function<void()>> tasks; //! queued tasks
+        };
+
+        /*! group of tasks from one parallel_for call, tracks when all ran
+         */
+        struct Group
+        {
+            std::atomic<size_t> remaining; //! tasks of the group not yet done
+            std::mutex error_lock; //! guards error
+            std::exception_ptr error; //! first exception thrown by a task
+        };
+
+        std::vector<std::unique_ptr<Queue>> queues; //! one queue per worker
+        std::vector<std::thread> workers; //! the worker threads
+        std::mutex sleep_lock; //! guards queued and stopping for sleepers
+        std::condition_variable wake; //! signalled when tasks are queued
+        std::atomic<size_t> queued; //! tasks sitting in any queue
+        std::atomic<size_t> next_queue; //! round robin start for submitters
+        bool stopping; //! set once the pool is being destroyed
+
+        /*! current worker function, returns the worker index of this thread
+         * @brief current worker, index of the calling thread in its pool
+         * @pre none
+         * @post none
+         * @returns reference to the index, size_t(-1) if not a worker
+         */
+        static size_t& current_index()
+        {
+            static thread_local size_t index = size_t(-1);
+            return index;
+        }
+
+        /*! current pool function, returns the pool the thread works for
+         * @brief current pool, pool the calling thread is a worker of
+         * @pre none
+         * @post none
+         * @returns reference to the pool pointer, nullptr if not a worker
+         */
+        static const MyThreadPool*& current_pool()
+        {
+            static thread_local const MyThreadPool *pool = nullptr;
+            return pool;
+        }
+
+        /*! run one function, runs a single queued task if there is any
+         * @brief run one, takes one task from own queue or steals one
+         * @pre none
+         * @param[in] start queue to look in first, the caller's own
+         * @post pops the back of queue start, or else the front of the first
+         *       other nonempty queue, and runs it
+         * @returns true if a task ran, false if every queue was empty
+         */
+        bool run_one(const size_t start)
+        {
+            for(size_t n = 0; n < queues.size(); n++)
+            {
+                size_t q = (start + n) % queues.size();
+                std::function<void()> task;
+                {
+                    std::lock_guard<std::mutex> guard(queues[q]->lock);
+                    if(queues[q]->tasks.empty())
+                        continue;
+                    if(n == 0)
+                    {
+                        task = std::move(queues[q]->tasks.back());
+                        queues[q]->tasks.pop_back();
+                    }
+                    else
+                    {
+                        task = std::move(queues[q]->tasks.front());
+                        queues[q]->tasks.pop_front();
+                    }
+                }
+                queued--;
+                task();
+                return true;
+            }
+            return false;
+        }
+
+        /*! worker loop function, body of every worker thread
+         * @brief worker loop, runs and steals tasks until the pool stops
+         * @pre none
+         * @param[in] index the worker's own queue
+         * @post runs tasks while there are any, sleeps while there are none
+         */
+        void worker_loop(const size_t index)
+        {
+            current_index() = index;
+            current_pool() = this;
+            while(true)
+            {
+                if(run_one(index))
+                    continue;
+                std::unique_lock<std::mutex> guard(sleep_lock);
+                wake.wait(guard, [this] { return stopping || queued > 0; });
+                if(stopping && queued == 0)
+                    return;
+            }
+        }
+
+    public:
+        /*! Parameterized constructor, starts a pool of the given size
+         * @brief param. constructor, starts num_workers worker threads
+         * @pre none
+         * @param[in] num_workers amount of worker threads, the thread calling
+         *            parallel_for helps as well
+         * @post creates the queues and starts the workers, which sleep until
+         *       work arrives
+         */
+        explicit MyThreadPool(const size_t num_workers): queued(0),
+            next_queue(0), stopping(false)
+        {
+            for(size_t w = 0; w < std::max(num_workers, size_t(1)); w++)
+                queues.push_back(std::unique_ptr<Queue>(new Queue()));
+            for(size_t w = 0; w < num_workers; w++)
+                workers.push_back(std::thread(&MyThreadPool::worker_loop, this, w));
+        }
+
+        /*! Destructor, stops and joins every worker
+         * @brief Destructor, lets workers finish queued work and joins them
+         * @pre no parallel_for may be running
+         * @post every worker thread has exited
+         */
+        ~MyThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> guard(sleep_lock);
+                stopping = true;
+            }
+            wake.notify_all();
+            for(size_t w = 0; w < workers.size(); w++)
+                workers[w].join();
+        }
+
+        MyThreadPool(const MyThreadPool&) = delete;
+        MyThreadPool& operator=(const MyThreadPool&) = delete;
+
+        /*! size function, returns the amount of worker threads
+         * @brief size function, returns amount of worker threads
+         * @pre none
+         * @post none
+         * @returns the amount of worker threads
+         */
+        size_t size() const { return workers.size(); }
+
+        /*! parallel for function, runs body over [begin, end) in pieces
+         * @brief parallel for, splits [begin, end) into grain sized pieces
+         * @pre body(lo, hi) must be safe to call concurrently for disjoint
+         *      ranges, grain must be positive
+         * @param[in] begin first index of the range
+         * @param[in] end one past the last index of the range
+         * @param[in] grain length of every piece (the last may be shorter)
+         * @param[in] body function called as body(lo, hi) for every piece
+         * @throw whatever the first throwing piece threw, once all finished
+         * @post queues every piece, then runs and steals pieces itself until
+         *       every piece is done; a worker calling parallel_for queues on
+         *       its own queue, so nested calls cannot deadlock
+         */
+        template <typename F>
+        void parallel_for(const size_t begin, const size_t end,
+            const size_t grain, const F &body)
+        {
+            if(begin >= end)
+                return;
+            const size_t pieces = (end - begin + grain - 1) / grain;
+            Group group;
+            group.remaining = pieces;
+
+            // counted before any piece is queued, so a worker taking one
+            // right away never drops the count below zero
+            {
+                std::lock_guard<std::mutex> guard(sleep_lock);
+                queued += pieces;
+            }
+            const bool is_worker = current_pool() == this;
+            const size_t home = is_worker ? current_index() :
+                next_queue++ % queues.size();
+            for(size_t p = 0; p < pieces; p++)
+            {
+                const size_t lo = begin + p * grain;
+                const size_t hi = std::min(end, lo + grain);
+                Group *g = &group;
+                std::function<void()> task = [g, &body, lo, hi]()
+                {
+                    try
+                    {
+                        body(lo, hi);
+                    }
+                    catch(...)
+                    {
+                        std::lock_guard<std::mutex> guard(g->error_lock);
+                        if(!g->error)
+                            g->error = std::current_exception();
+                    }
+                    g->remaining--;
+                };
+                // a worker keeps its pieces for itself to steal from, an
+                // outside caller spreads them over every queue
+                const size_t q = is_worker ? home : (home + p) % queues.size();
+                std::lock_guard<std::mutex> guard(queues[q]->lock);
+                queues[q]->tasks.push_back(std::move(task));
+            }
+            wake.notify_all();
+
+            while(group.remaining > 0)
+            {
+                if(!run_one(home))
+                    std::this_thread::yield();
+            }
+            if(group.error)
+                std::rethrow_exception(group.error);
+        }
+};
+
+/*! container pool function, returns the slot of the shared pool
+ * @brief container pool slot, owner of the pool every container shares
+ * @pre none
+ * @post none
+ * @returns reference to the pointer to the shared pool
+ */
+inline std::unique_ptr<MyThreadPool>& container_pool_slot()
+{
+    static std::unique_ptr<MyThreadPool> pool;
+    return pool;
+}
+
+/*! container threads function, returns the thread count setting
+ * @brief container threads, threads container operations may use
+ * @pre none
+ * @post none
+ * @returns reference to the setting, defaults to the hardware concurrency
+ */
+inline size_t& container_threads_setting()
+{
+    static size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+    return threads;
+}
+
+/*! set container threads function, sets threads container operations use
+ * @brief set container threads, sets worker count of the shared pool
+ * @pre no container operation may be running on another thread
+ * @param[in] threads threads to use, counting the calling thread; 0 means
+ *            one per hardware thread, 1 runs everything serially
+ * @post replaces the shared pool, the next parallel operation starts it
+ */
+inline void set_container_threads(const size_t threads)
+{
+    container_threads_setting() = (threads == 0) ?
+        std::max(std::thread::hardware_concurrency(), 1u) : threads;
+    container_pool_slot().reset();
+}
+
+/*! container threads function, returns threads container operations use
+ * @brief container threads, returns the thread count setting
+ * @pre none
+ * @post none
+ * @returns the threads, counting the calling thread, operations may use
+ */
+inline size_t container_threads()
+{
+    return container_threads_setting();
+}
+
+/*! container pool function, returns the pool containers share
+ * @brief container pool, returns the shared pool, starting it if needed
+ * @pre container_threads() must be more than 1
+ * @post starts a pool of container_threads() - 1 workers on first use
+ * @returns the shared pool
+ */
+inline MyThreadPool& container_pool()
+{
+    static std::mutex start_lock;
+    std::lock_guard<std::mutex> guard(start_lock);
+    std::unique_ptr<MyThreadPool> &pool = container_pool_slot();
+    if(!pool)
+        pool.reset(new MyThreadPool(container_threads() - 1));
+    return *pool;
+}
+
+/*! parallel for function, runs body over [0, n), split if n is large
+ * @brief parallel for, runs body(lo, hi) over [0, n) on the shared pool
+ * @pre body(lo, hi) must be safe to call concurrently for disjoint ranges
+ * @param[in] n amount of items
+ * @param[in] work rough amount of element operations per item
+ * @param[in] body function called as body(lo, hi) on pieces of [0, n)
+ * @post runs body(0, n) right away when n * work < PARALLEL_MIN_WORK or
+ *       only one thread is allowed, else runs pieces of about
+ *       PARALLEL_MIN_WORK work each on the shared pool
+ */
+template <typename F>
+void parallel_for(const size_t n, const size_t work, const F &body)
+{
+    const size_t grain = std::max(PARALLEL_MIN_WORK / std::max(work, size_t(1)),
+        size_t(1));
+    if(n <= grain || container_threads() <= 1)
+    {
+        body(size_t(0), n);
+        return;
+    }
+    container_pool().parallel_for(0, n, grain, body);
+}
+
+/*! parallel sum function, adds up body over pieces of [0, n)
+ * @brief parallel sum, sums body(lo, hi) over pieces of [0, n) in order
+ * @pre body(lo, hi) must be safe to call concurrently for disjoint ranges,
+ *      T() must be zero
+ * @param[in] n amount of items
+ * @param[in] work rough amount of element operations per item
+ * @param[in] body function returning the partial sum over [lo, hi)
+ * @post splits [0, n) into the same pieces whatever the thread count, and
+ *       adds their partial sums in order, so the result never depends on
+ *       how many threads ran
+ * @returns the sum of body over every piece
+ */
+template <typename T, typename F>
+T parallel_sum(const size_t n, const size_t work, const F &body)
+{
+    const size_t grain = std::max(PARALLEL_MIN_WORK / std::max(work, size_t(1)),
+        size_t(1));
+    if(n <= grain)
+        return body(size_t(0), n);
+
+    const size_t pieces = (n + grain - 1) / grain;
+    std::vector<T> partial(pieces);
+    auto piece_sum = [&](const size_t lo, const size_t hi)
+    {
+        for(size_t p = lo; p < hi; p++)
+            partial[p] = body(p * grain, std::min(n, (p + 1) * grain));
+    };
+    if(container_threads() <= 1)
+        piece_sum(0, pieces);
+    else
+        container_pool().parallel_for(0, pieces, 1, piece_sum);
+
+    T sum = T();
+    for(size_t p = 0; p < pieces; p++)
+        sum += partial[p];
+    return sum;
+}
+
+#endif
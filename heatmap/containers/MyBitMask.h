@@ -0,0 +1,221 @@
+#ifndef MY_BIT_MASK_H
+#define MY_BIT_MASK_H
+
+#include <cstdint>
+#include <string>
+#include "MyVector.h"
+#include "../../common/MyBoundsCheck.h"
+using std::string;
+
+/*! amount of pixels stored in one word of a MyBitMask */
+const size_t MASK_WORD_BITS = 64;
+
+/*!
+ * @brief popcount function, counts the set bits of a word
+ * @pre none
+ * @param[in] w word to count the bits of
+ * @post none
+ * @returns the amount of 1 bits in w
+ */
+inline size_t mask_popcount(uint64_t w)
+{
+#if defined(__GNUC__)
+    return size_t(__builtin_popcountll(w));
+#else
+    size_t count = 0;
+    for(; w != 0; w &= w - 1)
+        count++;
+    return count;
+#endif
+}
+
+/*!
+ * @brief lowest bit function, returns position of the lowest set bit
+ * @pre w must not be 0
+ * @param[in] w word to search
+ * @post none
+ * @returns the index (0 to 63) of the lowest 1 bit of w
+ */
+inline size_t mask_lowest_bit(uint64_t w)
+{
+#if defined(__GNUC__)
+    return size_t(__builtin_ctzll(w));
+#else
+    size_t bit = 0;
+    for(; (w & 1) == 0; w >>= 1)
+        bit++;
+    return bit;
+#endif
+}
+
+/*!
+ * @brief my bit mask class, black/white grid with one bit per pixel
+ */
+class MyBitMask;
+
+/*!
+ * @brief swap function, swaps contents of a and b
+ * @pre none
+ * @param[in,out] a lhs of MyBitMask swap
+ * @param[in,out] b rhs of MyBitMask swap
+ * @post swaps the contents of MyBitMask objects a and b
+ */
+void swap(MyBitMask &a, MyBitMask &b);
+
+/*!
+ * @brief extraction operator, outputs the mask as lines of 'B' and 'W'
+ * @pre none
+ * @param[in,out] out ostream object to output with
+ * @param[in] src mask to output
+ * @post outputs one line per row, 'B' for set pixels and 'W' for the rest,
+ *       the format of the b/w text files
+ * @returns the modified ostream object
+ */
+ostream& operator<<(ostream &out, const MyBitMask &src);
+
+/*!
+ * @brief my bit mask class, black/white grid with one bit per pixel; a set
+ *        bit is a 'B' pixel. every row starts at a new 64 bit word, bit
+ *        (j % 64) of word (j / 64) of a row is pixel j, and the bits past
+ *        the last col of a row are always 0
+ */
+class MyBitMask
+{
+    private:
+        MyVector<uint64_t> m_words; //! bits of every row, row after row
+        size_t r; //! number of rows of pixels
+        size_t c; //! number of cols of pixels
+        size_t m_row_words; //! words per row, ceil(c / 64)
+
+    public:
+        /*!
+         * @brief default constructor, creates mask of a 0x0 grid
+         * @pre none
+         * @post creates mybitmask object without pixels
+         */
+        MyBitMask(): m_words(), r(0), c(0), m_row_words(0) {}
+
+        /*!
+         * @brief param. constructor, creates all 'W' mask of rows x cols
+         * @pre none
+         * @param[in] rows number of rows of pixels
+         * @param[in] cols number of cols of pixels
+         * @post creates mask of rows x cols pixels, none of them set
+         */
+        MyBitMask(const size_t rows, const size_t cols);
+
+        /*!
+         * @brief param. constructor, packs the b/w grid of a text file
+         * @pre none
+         * @param[in] bwm_sep vector of strings, one per line of the b/w grid
+         * @post creates mask with one row per line and as many cols as the
+         *       longest line, setting the pixels that are 'B'; lines shorter
+         *       than the longest line are treated as padded with 'W'
+         */
+        explicit MyBitMask(const MyVector<string> &bwm_sep);
+
+        /*!
+         * @brief copy constructor, given existing mybitmask object
+         * @pre none
+         * @param[in] src existing mybitmask object to copy
+         * @post creates mybitmask object identical to src
+         */
+        MyBitMask(const MyBitMask &src);
+
+        /*!
+         * @brief assignment operator, assigns calling object equal to src
+         * @pre none
+         * @param[in] src copy of mybitmask object to swap with
+         * @post swaps contents of calling object and the copy src
+         * @returns the modified calling object after swap
+         */
+        MyBitMask& operator=(MyBitMask src);
+
+        /*!
+         * @brief eval operator, returns whether pixel (i, j) is set
+         * @pre i < rows(), j < cols()
+         * @param[in] i row of the pixel (0 is the top line of the image)
+         * @param[in] j col of the pixel
+         * @throw std::out_of_range if BOUNDS_CHECKED and i or j out of range
+         * @post none
+         * @returns true if pixel (i, j) is 'B'
+         */
+        bool operator()(const size_t i, const size_t j) const;
+
+        /*!
+         * @brief set function, sets or clears pixel (i, j)
+         * @pre i < rows(), j < cols()
+         * @param[in] i row of the pixel
+         * @param[in] j col of the pixel
+         * @param[in] val true to make the pixel 'B', false for 'W'
+         * @throw std::out_of_range if BOUNDS_CHECKED and i or j out of range
+         * @post pixel (i, j) is set if val, cleared otherwise
+         */
+        void set(const size_t i, const size_t j, const bool val);
+
+        /*!
+         * @brief row pointer function, returns the words of row i
+         * @pre i must be in range 0 <= i < rows()
+         * @param[in] i row of pixels
+         * @post returns pointer to row_words() words; writers must keep the
+         *       bits past the last col 0; never checks i
+         * @returns pointer to the first word of row i
+         */
+        uint64_t* row_ptr(const size_t i)
+            { return m_words.data() + i * m_row_words; }
+
+        /*!
+         * @brief row pointer function, returns the words of row i
+         * @pre i must be in range 0 <= i < rows()
+         * @param[in] i row of pixels
+         * @post returns pointer to row_words() words; never checks i
+         * @returns read-only pointer to the first word of row i
+         */
+        const uint64_t* row_ptr(const size_t i) const
+            { return m_words.data() + i * m_row_words; }
+
+        /*!
+         * @brief count function, returns the amount of set pixels
+         * @pre none
+         * @post counts the 'B' pixels, one popcount per word
+         * @returns the amount of set pixels in the mask
+         */
+        size_t count() const;
+
+        /*!
+         * @brief rows function, returns number of rows of pixels
+         * @pre none
+         * @post none
+         * @returns the number of rows of pixels
+         */
+        size_t rows() const { return r; }
+
+        /*!
+         * @brief cols function, returns number of cols of pixels
+         * @pre none
+         * @post none
+         * @returns the number of cols of pixels
+         */
+        size_t cols() const { return c; }
+
+        /*!
+         * @brief row words function, returns the amount of words per row
+         * @pre none
+         * @post none
+         * @returns the number of 64 bit words holding one row
+         */
+        size_t row_words() const { return m_row_words; }
+
+        /*!
+         * @brief swap function, swaps contents of a and b
+         * @pre none
+         * @param[in,out] a lhs of MyBitMask swap
+         * @param[in,out] b rhs of MyBitMask swap
+         * @post swaps the contents of MyBitMask objects a and b
+         */
+        friend void swap(MyBitMask &a, MyBitMask &b);
+};
+
+#include "MyBitMask.hpp"
+
+#endif
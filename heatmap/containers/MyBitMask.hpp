@@ -0,0 +1,79 @@
+MyBitMask::MyBitMask(const size_t rows, const size_t cols): m_words(),
+    r(rows), c(cols), m_row_words((cols + MASK_WORD_BITS - 1) / MASK_WORD_BITS)
+{
+    m_words = MyVector<uint64_t>(r * m_row_words);
+}
+
+MyBitMask::MyBitMask(const MyVector<string> &bwm_sep): MyBitMask()
+{
+    size_t cols = 0;
+    for(size_t i = 0; i < bwm_sep.size(); i++)
+        cols = std::max(cols, bwm_sep.data()[i].size());
+
+    MyBitMask mask(bwm_sep.size(), cols);
+    for(size_t i = 0; i < mask.r; i++)
+    {
+        const string &line = bwm_sep.data()[i];
+        uint64_t *row = mask.row_ptr(i);
+        for(size_t j = 0; j < line.size(); j++)
+            if(line[j] == 'B')
+                row[j / MASK_WORD_BITS] |= uint64_t(1) << (j % MASK_WORD_BITS);
+    }
+    swap(*this, mask);
+}
+
+MyBitMask::MyBitMask(const MyBitMask &src): m_words(src.m_words), r(src.r),
+    c(src.c), m_row_words(src.m_row_words) {}
+
+MyBitMask& MyBitMask::operator=(MyBitMask src)
+{
+    swap(*this, src);
+    return *this;
+}
+
+bool MyBitMask::operator()(const size_t i, const size_t j) const
+{
+    check_index(i, r, "i out of range for bit mask");
+    check_index(j, c, "j out of range for bit mask");
+    return (row_ptr(i)[j / MASK_WORD_BITS] >> (j % MASK_WORD_BITS)) & 1;
+}
+
+void MyBitMask::set(const size_t i, const size_t j, const bool val)
+{
+    check_index(i, r, "i out of range for bit mask");
+    check_index(j, c, "j out of range for bit mask");
+    uint64_t &word = row_ptr(i)[j / MASK_WORD_BITS];
+    const uint64_t bit = uint64_t(1) << (j % MASK_WORD_BITS);
+    word = val ? (word | bit) : (word & ~bit);
+}
+
+size_t MyBitMask::count() const
+{
+    size_t set_bits = 0;
+    const uint64_t *words = m_words.data();
+    for(size_t k = 0; k < m_words.size(); k++)
+        set_bits += mask_popcount(words[k]);
+    return set_bits;
+}
+
+void swap(MyBitMask &a, MyBitMask &b)
+{
+    swap(a.m_words, b.m_words);
+    std::swap(a.r, b.r);
+    std::swap(a.c, b.c);
+    std::swap(a.m_row_words, b.m_row_words);
+}
+
+ostream& operator<<(ostream &out, const MyBitMask &src)
+{
+    string line(src.cols(), 'W');
+    for(size_t i = 0; i < src.rows(); i++)
+    {
+        const uint64_t *row = src.row_ptr(i);
+        for(size_t j = 0; j < src.cols(); j++)
+            line[j] = ((row[j / MASK_WORD_BITS] >> (j % MASK_WORD_BITS)) & 1) ?
+                'B' : 'W';
+        out << line << '\n';
+    }
+    return out;
+}
@@ -0,0 +1,196 @@
+#ifndef MY_BIT_RANK_H
+#define MY_BIT_RANK_H
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include "MyVector.h"
+#include "MyBitMask.h"
+
+/*! words of the mask per rank block; one 64 bit count per block keeps the
+ *  directory at 1/8 of a bit per pixel, and a rank at most 8 popcounts
+ */
+const size_t RANK_BLOCK_WORDS = 8;
+
+/*!
+ * @brief my bit rank class, read-only bit mask with rank
+ */
+class MyBitRank;
+
+/*!
+ * @brief swap function, swaps contents of a and b
+ * @pre none
+ * @param[in,out] a lhs of MyBitRank swap
+ * @param[in,out] b rhs of MyBitRank swap
+ * @post swaps the contents of MyBitRank objects a and b
+ */
+void swap(MyBitRank &a, MyBitRank &b);
+
+/*!
+ * @brief my bit rank class, read-only bit mask with rank: the amount of
+ *        set pixels before a pixel in scan order. pixels are scanned left
+ *        to right, rows top to bottom or, for a bottom up rank, bottom to
+ *        top (the order the poisson unknowns are numbered in). a count of
+ *        the set bits before every block of RANK_BLOCK_WORDS words makes
+ *        rank constant time. together with the mask this takes about 1.125
+ *        bits per pixel, against 8 for a char per pixel
+ */
+class MyBitRank
+{
+    private:
+        MyBitMask m_mask; //! the pixels, rows stored in scan order
+        MyVector<uint64_t> m_block_rank; //! set bits before each block
+        bool m_bottom_up; //! true if rows are scanned bottom to top
+
+        /*!
+         * @brief word rank function, counts set bits before a word
+         * @pre w <= words in the mask
+         * @param[in] w index of a word of the mask, in scan order
+         * @post none
+         * @returns set bits in the words before w
+         */
+        size_t word_rank(const size_t w) const;
+
+        /*!
+         * @brief scan row function, returns the stored row of row i
+         * @pre i < rows()
+         * @param[in] i row of the pixel (0 is the top row)
+         * @post none
+         * @returns the index of row i in scan order
+         */
+        size_t scan_row(const size_t i) const
+            { return m_bottom_up ? m_mask.rows() - 1 - i : i; }
+
+    public:
+        /*!
+         * @brief default constructor, creates rank of a 0x0 mask
+         * @pre none
+         * @post creates mybitrank object without pixels
+         */
+        MyBitRank(): m_mask(), m_block_rank(1), m_bottom_up(false) {}
+
+        /*!
+         * @brief param. constructor, builds rank of mask
+         * @pre none
+         * @param[in] mask pixels to rank
+         * @param[in] bottom_up true to scan the rows bottom to top
+         * @post copies mask, rows in scan order, and counts its set bits in
+         *       one popcount per word
+         */
+        explicit MyBitRank(const MyBitMask &mask, const bool bottom_up = false);
+
+        /*!
+         * @brief copy constructor, given existing mybitrank object
+         * @pre none
+         * @param[in] src existing mybitrank object to copy
+         * @post creates mybitrank object identical to src
+         */
+        MyBitRank(const MyBitRank &src);
+
+        /*!
+         * @brief assignment operator, assigns calling object equal to src
+         * @pre none
+         * @param[in] src copy of mybitrank object to swap with
+         * @post swaps contents of calling object and the copy src
+         * @returns the modified calling object after swap
+         */
+        MyBitRank& operator=(MyBitRank src);
+
+        /*!
+         * @brief eval operator, returns whether pixel (i, j) is set
+         * @pre i < rows(), j < cols()
+         * @param[in] i row of the pixel (0 is the top row)
+         * @param[in] j col of the pixel
+         * @throw std::out_of_range if BOUNDS_CHECKED and i or j out of range
+         * @post none
+         * @returns true if pixel (i, j) is set
+         */
+        bool operator()(const size_t i, const size_t j) const;
+
+        /*!
+         * @brief rank function, counts the set pixels before pixel (i, j)
+         * @pre i < rows(), j <= cols()
+         * @param[in] i row of the pixel (0 is the top row)
+         * @param[in] j col of the pixel, cols() for the end of the row
+         * @throw std::out_of_range if i >= rows() or j > cols()
+         * @post counts in constant time, at most RANK_BLOCK_WORDS popcounts
+         * @returns the amount of set pixels before (i, j) in scan order,
+         *          which is the number of (i, j) among the set pixels
+         */
+        size_t rank(const size_t i, const size_t j) const;
+
+        /*!
+         * @brief row rank function, counts the set pixels left of (i, j)
+         * @pre i < rows(), j <= cols()
+         * @param[in] i row of the pixel
+         * @param[in] j col of the pixel, cols() for the end of the row
+         * @throw std::out_of_range if i >= rows() or j > cols()
+         * @post counts in constant time
+         * @returns the amount of set pixels in row i before col j
+         */
+        size_t row_rank(const size_t i, const size_t j) const
+            { return rank(i, j) - rank(i, 0); }
+
+        /*!
+         * @brief row pointer function, returns the words of row i
+         * @pre i < rows()
+         * @param[in] i row of pixels (0 is the top row)
+         * @post returns pointer to row_words() words; never checks i
+         * @returns read-only pointer to the first word of row i
+         */
+        const uint64_t* row_ptr(const size_t i) const
+            { return m_mask.row_ptr(scan_row(i)); }
+
+        /*!
+         * @brief count function, returns the amount of set pixels
+         * @pre none
+         * @post none
+         * @returns the amount of set pixels in the mask
+         */
+        size_t count() const { return m_block_rank[m_block_rank.size() - 1]; }
+
+        /*!
+         * @brief rows function, returns number of rows of pixels
+         * @pre none
+         * @post none
+         * @returns the number of rows of pixels
+         */
+        size_t rows() const { return m_mask.rows(); }
+
+        /*!
+         * @brief cols function, returns number of cols of pixels
+         * @pre none
+         * @post none
+         * @returns the number of cols of pixels
+         */
+        size_t cols() const { return m_mask.cols(); }
+
+        /*!
+         * @brief row words function, returns the amount of words per row
+         * @pre none
+         * @post none
+         * @returns the number of 64 bit words holding one row
+         */
+        size_t row_words() const { return m_mask.row_words(); }
+
+        /*!
+         * @brief bottom up function, returns the scan order of the rows
+         * @pre none
+         * @post none
+         * @returns true if rows are ranked bottom to top
+         */
+        bool bottom_up() const { return m_bottom_up; }
+
+        /*!
+         * @brief swap function, swaps contents of a and b
+         * @pre none
+         * @param[in,out] a lhs of MyBitRank swap
+         * @param[in,out] b rhs of MyBitRank swap
+         * @post swaps the contents of MyBitRank objects a and b
+         */
+        friend void swap(MyBitRank &a, MyBitRank &b);
+};
+
+#include "MyBitRank.hpp"
+
+#endif
@@ -0,0 +1,75 @@
+MyBitRank::MyBitRank(const MyBitMask &mask, const bool bottom_up):
+    m_mask(), m_block_rank(), m_bottom_up(bottom_up)
+{
+    if(!bottom_up)
+        m_mask = mask;
+    else
+    {
+        m_mask = MyBitMask(mask.rows(), mask.cols());
+        for(size_t i = 0; i < mask.rows(); i++)
+            std::copy(mask.row_ptr(i), mask.row_ptr(i) + mask.row_words(),
+                m_mask.row_ptr(mask.rows() - 1 - i));
+    }
+
+    // rows are padded to whole words, so the words of the mask are one
+    // contiguous run in scan order
+    const size_t words = m_mask.rows() * m_mask.row_words();
+    const size_t blocks = (words + RANK_BLOCK_WORDS - 1) / RANK_BLOCK_WORDS;
+    const uint64_t *data = m_mask.row_ptr(0);
+    m_block_rank.reserve(blocks + 1);
+    m_block_rank.push_back(0);
+    uint64_t set_bits = 0;
+    for(size_t b = 0; b < blocks; b++)
+    {
+        const size_t end = std::min(words, (b + 1) * RANK_BLOCK_WORDS);
+        for(size_t w = b * RANK_BLOCK_WORDS; w < end; w++)
+            set_bits += mask_popcount(data[w]);
+        m_block_rank.push_back(set_bits);
+    }
+}
+
+MyBitRank::MyBitRank(const MyBitRank &src): m_mask(src.m_mask),
+    m_block_rank(src.m_block_rank), m_bottom_up(src.m_bottom_up) {}
+
+MyBitRank& MyBitRank::operator=(MyBitRank src)
+{
+    swap(*this, src);
+    return *this;
+}
+
+bool MyBitRank::operator()(const size_t i, const size_t j) const
+{
+    check_index(i, rows(), "i out of range for bit rank");
+    return m_mask(scan_row(i), j);
+}
+
+size_t MyBitRank::word_rank(const size_t w) const
+{
+    const uint64_t *data = m_mask.row_ptr(0);
+    const size_t b = w / RANK_BLOCK_WORDS;
+    size_t set_bits = m_block_rank[b];
+    for(size_t v = b * RANK_BLOCK_WORDS; v < w; v++)
+        set_bits += mask_popcount(data[v]);
+    return set_bits;
+}
+
+size_t MyBitRank::rank(const size_t i, const size_t j) const
+{
+    if(i >= rows() || j > cols())
+        throw std::out_of_range("pixel out of range for bit rank rank()");
+
+    const size_t w = scan_row(i) * row_words() + j / MASK_WORD_BITS;
+    const size_t bit = j % MASK_WORD_BITS;
+    size_t set_bits = word_rank(w);
+    if(bit != 0)
+        set_bits += mask_popcount(m_mask.row_ptr(0)[w] &
+            ((uint64_t(1) << bit) - 1));
+    return set_bits;
+}
+
+void swap(MyBitRank &a, MyBitRank &b)
+{
+    swap(a.m_mask, b.m_mask);
+    swap(a.m_block_rank, b.m_block_rank);
+    std::swap(a.m_bottom_up, b.m_bottom_up);
+}
@@ -0,0 +1,551 @@
+#ifndef MY_EXPRESSION_H
+#define MY_EXPRESSION_H
+
+#include <cstddef>
+#include <iostream>
+#include <stdexcept>
+#include "../../common/MyThreadPool.h"
+
+/*! expression templates for MyVector and MyMatrix arithmetic
+ *
+ * elementwise +, - and scalar * on vectors and matrices do not compute
+ * anything, they return a small node recording their operands; a chain of
+ * them is only evaluated when it is assigned to (or used to construct) a
+ * MyVector or MyMatrix, in one loop that reads every operand once and
+ * writes the result once, without temporaries in between. leaves (actual
+ * vectors and matrices) are held by reference and nodes by value, so an
+ * expression must be assigned within the statement that built it.
+ */
+
+template <typename T>
+class MyVector;
+
+template <typename T>
+class MyMatrix;
+
+/*! vector expression base, CRTP base of MyVector and every vector node
+ * @brief MyVectorExpr class, static interface of anything that evaluates
+ *        to a vector of T; E is the deriving type
+ */
+template <typename E, typename T>
+class MyVectorExpr
+{
+    public:
+        /*! self function, returns the calling object as its deriving type
+         * @brief self function, returns calling object as deriving type E
+         * @pre none
+         * @post casts the calling object down to E
+         * @returns the calling object as an E
+         */
+        const E& self() const { return static_cast<const E&>(*this); }
+
+        /*! Size function, returns the length of the expression's result
+         * @brief Size function, returns length of expression's result
+         * @pre none
+         * @post returns the amount of elements the expression evaluates to
+         * @returns the amount of elements the expression evaluates to
+         */
+        size_t size() const { return self().size(); }
+
+        /*! elem function, evaluates element i of the expression
+         * @brief elem function, evaluates element i of expression, unchecked
+         * @pre i must be in range 0 <= i < size()
+         * @param[in] i index of the element to evaluate
+         * @post evaluates only element i of every operand
+         * @returns the value of element i of the expression
+         */
+        T elem(const size_t i) const { return self().elem(i); }
+};
+
+/*! matrix expression base, CRTP base of MyMatrix and every matrix node
+ * @brief MyMatrixExpr class, static interface of anything that evaluates
+ *        to a matrix of T; E is the deriving type
+ */
+template <typename E, typename T>
+class MyMatrixExpr
+{
+    public:
+        /*! self function, returns the calling object as its deriving type
+         * @brief self function, returns calling object as deriving type E
+         * @pre none
+         * @post casts the calling object down to E
+         * @returns the calling object as an E
+         */
+        const E& self() const { return static_cast<const E&>(*this); }
+
+        /*! rows function, returns the amount of rows of the result
+         * @brief rows function, returns amount of rows of the result
+         * @pre none
+         * @post returns the amount of rows the expression evaluates to
+         * @returns the amount of rows the expression evaluates to
+         */
+        size_t rows() const { return self().rows(); }
+
+        /*! cols function, returns the amount of columns of the result
+         * @brief cols function, returns amount of columns of the result
+         * @pre none
+         * @post returns the amount of columns the expression evaluates to
+         * @returns the amount of columns the expression evaluates to
+         */
+        size_t cols() const { return self().cols(); }
+
+        /*! elem function, evaluates element (i, j) of the expression
+         * @brief elem function, evaluates element (i, j), unchecked
+         * @pre i, j must be in range of the result
+         * @param[in] i row of the element to evaluate
+         * @param[in] j column of the element to evaluate
+         * @post evaluates only element (i, j) of every operand
+         * @returns the value of element (i, j) of the expression
+         */
+        T elem(const size_t i, const size_t j) const { return self().elem(i, j); }
+
+        /*! reads function, returns whether the expression reads matrix m
+         * @brief reads function, whether any matrix of the expression is m
+         * @pre none
+         * @param[in] m address of a matrix
+         * @post none
+         * @returns true if m is one of the matrices the expression reads
+         */
+        bool reads(const void *m) const { return self().reads(m); }
+
+        /*! reads transposed function, returns whether the expression reads
+         *  matrix m through a transposed view
+         * @brief reads transposed function, whether a transposed node reads m
+         * @pre none
+         * @param[in] m address of a matrix
+         * @post none
+         * @returns true if element (i, j) of the expression may depend on an
+         *          element of m other than (i, j), so it cannot be written
+         *          into m while it is evaluated
+         */
+        bool reads_transposed(const void *m) const
+            { return self().reads_transposed(m); }
+};
+
+/*! operand storage, how an expression node holds one of its operands
+ * @brief MyExprOperand struct, nodes are stored by value (they are tiny
+ *        and usually temporaries), vectors and matrices by reference
+ */
+template <typename E>
+struct MyExprOperand
+{
+    typedef const E type;
+};
+
+template <typename T>
+struct MyExprOperand<MyVector<T>>
+{
+    typedef const MyVector<T>& type;
+};
+
+template <typename T>
+struct MyExprOperand<MyMatrix<T>>
+{
+    typedef const MyMatrix<T>& type;
+};
+
+/*! vector sum node, elementwise l + r
+ * @brief MyVectorSum class, lazy elementwise sum of two vector expressions
+ */
+template <typename L, typename R, typename T>
+class MyVectorSum: public MyVectorExpr<MyVectorSum<L, R, T>, T>
+{
+    private:
+        typename MyExprOperand<L>::type m_l; //! lhs of the sum
+        typename MyExprOperand<R>::type m_r; //! rhs of the sum
+
+    public:
+        /*! Parameterized constructor, given both operands of the sum
+         * @brief param. constructor, given both operands of the sum
+         * @pre l and r must be of the same size
+         * @param[in] l lhs vector expression
+         * @param[in] r rhs vector expression
+         * @throw std::invalid_argument if l and r are different sizes
+         * @post records l and r, nothing is evaluated yet
+         */
+        MyVectorSum(const L &l, const R &r): m_l(l), m_r(r)
+        {
+            if(l.size() != r.size())
+                throw std::invalid_argument("lhs and rhs of + not same size");
+        }
+
+        size_t size() const { return m_l.size(); }
+        T elem(const size_t i) const { return m_l.elem(i) + m_r.elem(i); }
+};
+
+/*! vector difference node, elementwise l - r
+ * @brief MyVectorDiff class, lazy elementwise difference of two vectors
+ */
+template <typename L, typename R, typename T>
+class MyVectorDiff: public MyVectorExpr<MyVectorDiff<L, R, T>, T>
+{
+    private:
+        typename MyExprOperand<L>::type m_l; //! lhs of the difference
+        typename MyExprOperand<R>::type m_r; //! rhs of the difference
+
+    public:
+        /*! Parameterized constructor, given both operands of the difference
+         * @brief param. constructor, given both operands of the difference
+         * @pre l and r must be of the same size
+         * @param[in] l lhs vector expression
+         * @param[in] r rhs vector expression
+         * @throw std::invalid_argument if l and r are different sizes
+         * @post records l and r, nothing is evaluated yet
+         */
+        MyVectorDiff(const L &l, const R &r): m_l(l), m_r(r)
+        {
+            if(l.size() != r.size())
+                throw std::invalid_argument("lhs and rhs of - not same size");
+        }
+
+        size_t size() const { return m_l.size(); }
+        T elem(const size_t i) const { return m_l.elem(i) - m_r.elem(i); }
+};
+
+/*! scaled vector node, every element of e times scalar s
+ * @brief MyVectorScaled class, lazy product of a vector expression and scalar
+ */
+template <typename E, typename T>
+class MyVectorScaled: public MyVectorExpr<MyVectorScaled<E, T>, T>
+{
+    private:
+        typename MyExprOperand<E>::type m_e; //! vector expression to scale
+        T m_s; //! scalar to multiply every element by
+
+    public:
+        /*! Parameterized constructor, given the vector and the scalar
+         * @brief param. constructor, given the vector and the scalar
+         * @pre none
+         * @param[in] e vector expression to scale
+         * @param[in] s scalar to multiply every element by
+         * @post records e and s, nothing is evaluated yet
+         */
+        MyVectorScaled(const E &e, const T &s): m_e(e), m_s(s) {}
+
+        size_t size() const { return m_e.size(); }
+        T elem(const size_t i) const { return m_e.elem(i) * m_s; }
+};
+
+/*! matrix sum node, elementwise l + r
+ * @brief MyMatrixSum class, lazy elementwise sum of two matrix expressions
+ */
+template <typename L, typename R, typename T>
+class MyMatrixSum: public MyMatrixExpr<MyMatrixSum<L, R, T>, T>
+{
+    private:
+        typename MyExprOperand<L>::type m_l; //! lhs of the sum
+        typename MyExprOperand<R>::type m_r; //! rhs of the sum
+
+    public:
+        /*! Parameterized constructor, given both operands of the sum
+         * @brief param. constructor, given both operands of the sum
+         * @pre l and r must be of the same size
+         * @param[in] l lhs matrix expression
+         * @param[in] r rhs matrix expression
+         * @throw std::invalid_argument if l and r are different sizes
+         * @post records l and r, nothing is evaluated yet
+         */
+        MyMatrixSum(const L &l, const R &r): m_l(l), m_r(r)
+        {
+            if(l.rows() != r.rows() || l.cols() != r.cols())
+                throw std::invalid_argument("cant add matrices, different sizes");
+        }
+
+        size_t rows() const { return m_l.rows(); }
+        size_t cols() const { return m_l.cols(); }
+        T elem(const size_t i, const size_t j) const
+            { return m_l.elem(i, j) + m_r.elem(i, j); }
+        bool reads(const void *m) const
+            { return m_l.reads(m) || m_r.reads(m); }
+        bool reads_transposed(const void *m) const
+            { return m_l.reads_transposed(m) || m_r.reads_transposed(m); }
+};
+
+/*! matrix difference node, elementwise l - r
+ * @brief MyMatrixDiff class, lazy elementwise difference of two matrices
+ */
+template <typename L, typename R, typename T>
+class MyMatrixDiff: public MyMatrixExpr<MyMatrixDiff<L, R, T>, T>
+{
+    private:
+        typename MyExprOperand<L>::type m_l; //! lhs of the difference
+        typename MyExprOperand<R>::type m_r; //! rhs of the difference
+
+    public:
+        /*! Parameterized constructor, given both operands of the difference
+         * @brief param. constructor, given both operands of the difference
+         * @pre l and r must be of the same size
+         * @param[in] l lhs matrix expression
+         * @param[in] r rhs matrix expression
+         * @throw std::invalid_argument if l and r are different sizes
+         * @post records l and r, nothing is evaluated yet
+         */
+        MyMatrixDiff(const L &l, const R &r): m_l(l), m_r(r)
+        {
+            if(l.rows() != r.rows() || l.cols() != r.cols())
+                throw std::invalid_argument("cant minus matrices, different sizes");
+        }
+
+        size_t rows() const { return m_l.rows(); }
+        size_t cols() const { return m_l.cols(); }
+        T elem(const size_t i, const size_t j) const
+            { return m_l.elem(i, j) - m_r.elem(i, j); }
+        bool reads(const void *m) const
+            { return m_l.reads(m) || m_r.reads(m); }
+        bool reads_transposed(const void *m) const
+            { return m_l.reads_transposed(m) || m_r.reads_transposed(m); }
+};
+
+/*! scaled matrix node, every element of e times scalar s
+ * @brief MyMatrixScaled class, lazy product of a matrix expression and scalar
+ */
+template <typename E, typename T>
+class MyMatrixScaled: public MyMatrixExpr<MyMatrixScaled<E, T>, T>
+{
+    private:
+        typename MyExprOperand<E>::type m_e; //! matrix expression to scale
+        T m_s; //! scalar to multiply every element by
+
+    public:
+        /*! Parameterized constructor, given the matrix and the scalar
+         * @brief param. constructor, given the matrix and the scalar
+         * @pre none
+         * @param[in] e matrix expression to scale
+         * @param[in] s scalar to multiply every element by
+         * @post records e and s, nothing is evaluated yet
+         */
+        MyMatrixScaled(const E &e, const T &s): m_e(e), m_s(s) {}
+
+        size_t rows() const { return m_e.rows(); }
+        size_t cols() const { return m_e.cols(); }
+        T elem(const size_t i, const size_t j) const
+            { return m_e.elem(i, j) * m_s; }
+        bool reads(const void *m) const { return m_e.reads(m); }
+        bool reads_transposed(const void *m) const
+            { return m_e.reads_transposed(m); }
+};
+
+/*! transposed matrix node, element (i, j) is element (j, i) of e
+ * @brief MyMatrixTransposed class, zero-copy transposed view of a matrix
+ *        expression; reading it never builds the transpose
+ */
+template <typename E, typename T>
+class MyMatrixTransposed: public MyMatrixExpr<MyMatrixTransposed<E, T>, T>
+{
+    private:
+        typename MyExprOperand<E>::type m_e; //! matrix expression viewed
+
+    public:
+        /*! Parameterized constructor, given the expression to view
+         * @brief param. constructor, given the expression to view
+         * @pre none
+         * @param[in] e matrix expression to view transposed
+         * @post records e, nothing is copied or evaluated
+         */
+        explicit MyMatrixTransposed(const E &e): m_e(e) {}
+
+        /*! operand function, returns the expression being viewed
+         * @brief operand function, returns the untransposed expression
+         * @pre none
+         * @post none
+         * @returns the expression this node views transposed
+         */
+        const E& operand() const { return m_e; }
+
+        size_t rows() const { return m_e.cols(); }
+        size_t cols() const { return m_e.rows(); }
+        T elem(const size_t i, const size_t j) const
+            { return m_e.elem(j, i); }
+        bool reads(const void *m) const { return m_e.reads(m); }
+        bool reads_transposed(const void *m) const { return m_e.reads(m); }
+};
+
+/*! vector addition, lazily adds vector expressions a and b
+ * @brief vector addition, returns node adding a and b elementwise
+ * @pre a must be of same size as b, T must support addition
+ * @param[in] a vector expression of same size as b to add with
+ * @param[in] b vector expression of same size as a to add with
+ * @throw std::invalid_argument if a is not same size as b
+ * @post records a + b, evaluated when assigned to a MyVector
+ * @returns the node representing a + b
+ */
+template <typename L, typename R, typename T>
+MyVectorSum<L, R, T> operator+(const MyVectorExpr<L, T> &a,
+    const MyVectorExpr<R, T> &b)
+{
+    return MyVectorSum<L, R, T>(a.self(), b.self());
+}
+
+/*! vector subtraction, lazily subtracts vector expression b from a
+ * @brief vector subtraction, returns node subtracting b from a elementwise
+ * @pre a must be of same size as b, T must support subtraction
+ * @param[in] a vector expression of same size as b to subtract from
+ * @param[in] b vector expression of same size as a to subtract
+ * @throw std::invalid_argument if a is not same size as b
+ * @post records a - b, evaluated when assigned to a MyVector
+ * @returns the node representing a - b
+ */
+template <typename L, typename R, typename T>
+MyVectorDiff<L, R, T> operator-(const MyVectorExpr<L, T> &a,
+    const MyVectorExpr<R, T> &b)
+{
+    return MyVectorDiff<L, R, T>(a.self(), b.self());
+}
+
+/*! scalar multiplication, lazily multiplies all elements of lhs by rhs
+ * @brief scalar mult., returns node multiplying all elements of lhs by rhs
+ * @pre T must be of type that supports multiplication
+ * @param[in] lhs a vector expression w/ elements to be multiplied
+ * @param[in] rhs a scalar value of type T to multiply with
+ * @post records lhs * rhs, evaluated when assigned to a MyVector
+ * @returns the node representing lhs * rhs
+ */
+template <typename E, typename T>
+MyVectorScaled<E, T> operator*(const MyVectorExpr<E, T> &lhs, const T &rhs)
+{
+    return MyVectorScaled<E, T>(lhs.self(), rhs);
+}
+
+/*! scalar multiplication, lazily multiplies all elements of rhs by lhs
+ * @brief scalar mult., returns node multiplying all elements of rhs by lhs
+ * @pre T must be of type that supports multiplication
+ * @param[in] lhs a scalar value of type T to multiply with
+ * @param[in] rhs a vector expression w/ elements to be multiplied
+ * @post records rhs * lhs, evaluated when assigned to a MyVector
+ * @returns the node representing rhs * lhs
+ */
+template <typename E, typename T>
+MyVectorScaled<E, T> operator*(const T lhs, const MyVectorExpr<E, T> &rhs)
+{
+    return MyVectorScaled<E, T>(rhs.self(), lhs);
+}
+
+/*! dot product operator, compute dot product of lhs and rhs
+ * @brief dot product, computes dot product of lhs and rhs
+ * @pre lhs must be of same size as rhs, T must support multiplication
+ * @param[in] lhs a vector expression to compute dot product with
+ * @param[in] rhs a vector expression to compute dot product with
+ * @throw std::invalid_argument if lhs is not same size as rhs
+ * @post evaluates both expressions elementwise inside the one summing loop
+ * @returns the dot product of lhs and rhs
+ */
+template <typename L, typename R, typename T>
+T operator*(const MyVectorExpr<L, T> &lhs, const MyVectorExpr<R, T> &rhs)
+{
+    if(lhs.size() != rhs.size())
+        throw std::invalid_argument("lhs and rhs for * not of same size");
+
+    const L &l = lhs.self();
+    const R &r = rhs.self();
+    return parallel_sum<T>(l.size(), 1, [&](const size_t lo, const size_t hi) -> T
+    {
+        T sum = 0;
+        for(size_t i = lo; i < hi; i++)
+            sum += l.elem(i) * r.elem(i);
+        return sum;
+    });
+}
+
+/*! matrix addition, lazily adds matrix expressions a and b
+ * @brief matrix addition, returns node adding a and b elementwise
+ * @pre type T must be capable of addition, a and b are same size
+ * @param[in] a matrix expression, lhs of addition operator
+ * @param[in] b matrix expression, rhs of addition operator
+ * @throw std::invalid_argument if a and b are different sizes
+ * @post records a + b, evaluated when assigned to a MyMatrix
+ * @returns the node representing a + b
+ */
+template <typename L, typename R, typename T>
+MyMatrixSum<L, R, T> operator+(const MyMatrixExpr<L, T> &a,
+    const MyMatrixExpr<R, T> &b)
+{
+    return MyMatrixSum<L, R, T>(a.self(), b.self());
+}
+
+/*! matrix subtraction, lazily subtracts matrix expression b from a
+ * @brief matrix subtraction, returns node subtracting b from a elementwise
+ * @pre type T must be capable of subtraction, a and b are same size
+ * @param[in] a matrix expression, lhs of subtraction operator
+ * @param[in] b matrix expression, rhs of subtraction operator
+ * @throw std::invalid_argument if a and b are different sizes
+ * @post records a - b, evaluated when assigned to a MyMatrix
+ * @returns the node representing a - b
+ */
+template <typename L, typename R, typename T>
+MyMatrixDiff<L, R, T> operator-(const MyMatrixExpr<L, T> &a,
+    const MyMatrixExpr<R, T> &b)
+{
+    return MyMatrixDiff<L, R, T>(a.self(), b.self());
+}
+
+/*! scalar multiplication, lazily multiplies matrix a by scalar b
+ * @brief scalar multiplication, returns node multiplying a by scalar b
+ * @pre type T must be capable of multiplication
+ * @param[in] a matrix expression, each value is multiplied by scalar b
+ * @param[in] b scalar value of type T to be multiplied by elements of a
+ * @post records a * b, evaluated when assigned to a MyMatrix
+ * @returns the node representing a * b
+ */
+template <typename E, typename T>
+MyMatrixScaled<E, T> operator*(const MyMatrixExpr<E, T> &a, const T b)
+{
+    return MyMatrixScaled<E, T>(a.self(), b);
+}
+
+/*! scalar multiplication, lazily multiplies matrix b by scalar a
+ * @brief scalar multiplication, returns node multiplying b by scalar a
+ * @pre type T must be capable of multiplication
+ * @param[in] a scalar value of type T to be multiplied by elements of b
+ * @param[in] b matrix expression, each value is multiplied by scalar a
+ * @post records b * a, evaluated when assigned to a MyMatrix
+ * @returns the node representing b * a
+ */
+template <typename E, typename T>
+MyMatrixScaled<E, T> operator*(const T a, const MyMatrixExpr<E, T> &b)
+{
+    return MyMatrixScaled<E, T>(b.self(), a);
+}
+
+/*! transposed function, returns a transposed view of matrix expression e
+ * @brief transposed function, returns zero-copy transposed view of e
+ * @pre none
+ * @param[in] e matrix expression (or matrix) to view transposed
+ * @post records e, evaluated (cache obliviously when e is a plain matrix)
+ *       only when assigned to a MyMatrix or used in a product
+ * @returns the node viewing e transposed
+ */
+template <typename E, typename T>
+MyMatrixTransposed<E, T> transposed(const MyMatrixExpr<E, T> &e)
+{
+    return MyMatrixTransposed<E, T>(e.self());
+}
+
+/*! extraction operator, outputs the evaluated vector expression e
+ * @brief extraction operator, outputs value of vector expression e
+ * @pre none
+ * @param[in,out] out ostream object to output with
+ * @param[in] e vector expression (e.g. a + b * s) to be outputted
+ * @post evaluates e into a MyVector and outputs it like one
+ * @returns the modified ostream object
+ */
+template <typename E, typename T>
+std::ostream& operator<<(std::ostream &out, const MyVectorExpr<E, T> &e)
+{
+    return out << MyVector<T>(e);
+}
+
+/*! extraction operator, outputs the evaluated matrix expression e
+ * @brief extraction operator, outputs value of matrix expression e
+ * @pre none
+ * @param[in,out] out ostream object to output with
+ * @param[in] e matrix expression (e.g. a + b * s) to be outputted
+ * @post evaluates e into a MyMatrix and outputs it like one
+ * @returns the modified ostream object
+ */
+template <typename E, typename T>
+std::ostream& operator<<(std::ostream &out, const MyMatrixExpr<E, T> &e)
+{
+    return out << MyMatrix<T>(e);
+}
+
+#endif
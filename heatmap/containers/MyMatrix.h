@@ -2,14 +2,23 @@
 #define MY_MATRIX_H
 
 #include "MyVector.h"
+#include "MyRowView.h"
+#include "../../common/MyAllocator.h"
+#include "../../common/MyBoundsCheck.h"
+#include "MyExpression.h"
+#include "../../common/MyGemm.h"
+#include "MyTranspose.h"
 using std::initializer_list;
 
-/*! matrix class, matrix created via implementation of nested vector
- * @brief MyMatrix class, matrix via nested MyVectors, supports arithmetic
+/*! matrix class, matrix stored in one contiguous row-major buffer
+ * @brief MyMatrix class, matrix via contiguous aligned rows, supports arithmetic
  */
 template <typename T>
 class MyMatrix;
 
+template <typename T>
+class MyLUDecomp;
+
 /*! extraction operator, outputs contents of src to console
  * @brief extraction operator, outputs contents of src to console
  * @pre none
@@ -34,71 +43,49 @@ istream& operator>>(istream &in, MyMatrix<T> &src);
 
 /*! swap function, swaps contents of a and b
  * @brief swap function, swaps contents of a and b
- * @pre a and b must be matrices of same size
+ * @pre none
  * @param[in,out] a matrix object, lhs of the swap function
  * @param[in,out] b matrix object, rhs of the swap function
- * @throw std::invalid_argument if a and b are not the same size
- * @post swaps the matrix contents of a and b
+ * @post swaps the matrix contents (and sizes) of a and b
  */
 template <typename T>
-void swap(MyMatrix<T> &a, MyMatrix<T> &b);
-
-/*! matrix addition, adds matrices a and b and returns new matrix
- * @brief matrix addition, adds matrices a and b and returns new matrix
- * @pre type T must be capable of addition, a and b are same size
- * @param[in] a matrix object, lhs of addition operator
- * @param[in] b matrix object, rhs of addition operator
- * @post add the contents of a and b to a new matrix
- * @returns the new matrix after all addition completed
+void swap(MyMatrix<T> &a, MyMatrix<T> &b) noexcept;
+
+/*! materialize function, returns matrix a itself
+ * @brief materialize function, returns matrix a itself, without copying
+ * @pre none
+ * @param[in] a matrix object
+ * @post none, a is already evaluated
+ * @returns a
  */
 template <typename T>
-MyMatrix<T> operator+(const MyMatrix<T> &a, const MyMatrix<T> &b);
-
-/*! matrix subtraction, minus matrices a and b and returns new matrix
- * @brief matrix subtraction, minus matrices a and b and returns new matrix
- * @pre type T must be capable of subtraction, a and b are same size
- * @param[in] a matrix object, lhs of subtraction operator
- * @param[in] b matrix object, rhs of subtraction operator
- * @post subtract the contents of a and b to a new matrix
- * @returns the new matrix after all subtraction completed
+const MyMatrix<T>& materialize(const MyMatrix<T> &a) { return a; }
+
+/*! materialize function, evaluates matrix expression e into a new matrix
+ * @brief materialize function, evaluates matrix expression e
+ * @pre none
+ * @param[in] e matrix expression (e.g. a + b * s) to evaluate
+ * @post evaluates every element of e in a single pass
+ * @returns the new matrix holding the value of e
  */
-template <typename T>
-MyMatrix<T> operator-(const MyMatrix<T> &a, const MyMatrix<T> &b);
+template <typename E, typename T>
+MyMatrix<T> materialize(const MyMatrixExpr<E, T> &e) { return MyMatrix<T>(e); }
 
 /*! matrix multiplication, multiples matrices a and b, returns result
  * @brief matrix multiplying, multiples matrices a and b, return result
  * @pre type T must be capable of addition and multiplication, the cols of
  *      the matrix 'a' must be equal to the rows of the matrix 'b'
- * @param[in] a matrix object, lhs of multiplication operator
- * @param[in] b matrix object, rhs of multiplication operator
+ * @param[in] a matrix expression, lhs of multiplication operator
+ * @param[in] b matrix expression, rhs of multiplication operator
  * @throw std::invalid_argument if a.cols() != b.rows()
- * @post multiplies matrices a and b
+ * @post multiplies matrices a and b with the cache blocked (and for float
+ *       and double, SIMD) gemm of MyGemm.h; an operand that is an elementwise
+ *       expression is evaluated once up front, since every element of it
+ *       is read many times
  * @returns the new matrix containing result of multiplying a and b
  */
-template <typename T>
-MyMatrix<T> operator*(const MyMatrix<T> &a, const MyMatrix<T> &b);
-
-/*! scalar multiplication, multiplies matrix b by scalar a
- * @brief scalar multiplication, multiplies matrix b by scalar a
- * @pre type T must be capable of multiplication
- * @param[in] a scalar value of type T to be multiplied by elements of b
- * @param[in] b matrix, each value is multiplied by scalar a
- * @post multiples each value of matrix b by scalar a
- * @returns new matrix object after all multiplication is completed
- */
-template <typename T>
-MyMatrix<T> operator*(const T a, const MyMatrix<T> &b);
-
-/*! scalar multiplication, multiplies matrix a by scalar b
- * @brief scalar multiplication, multiplies matrix a by scalar b
- * @pre type T must be capable of multiplication
- * @param[in] b scalar value of type T to be multiplied by elements of a
- * @param[in] a matrix, each value is multiplied by scalar b
- * @post multiples each value of matrix a by scalar b
- * @returns new matrix object after all multiplication is completed
- */
-template <typename T>
-MyMatrix<T> operator*(const MyMatrix<T> &a, const T b);
+template <typename L, typename R, typename T>
+MyMatrix<T> operator*(const MyMatrixExpr<L, T> &a, const MyMatrixExpr<R, T> &b);
 
 /*! vector * matrix multiplication, multiplies vector a by matrix b
  * @brief vector*matrix multiplication, multiplies vector a by matrix b
@@ -126,16 +113,40 @@ MyMatrix<T> operator*(const MyVector<T> &a, const MyMatrix<T> &b);
 template <typename T>
 MyVector<T> operator*(const MyMatrix<T> &a, const MyVector<T> &b);
 
-/*! matrix class, matrix created via implementation of nested vector
- * @brief MyMatrix class, matrix via nested MyVectors, supports arithmetic
+/*! matrix class, matrix stored in one contiguous row-major buffer
+ * @brief MyMatrix class, matrix via contiguous aligned rows, supports
+ *        arithmetic; +, - and scalar * build MyExpression.h nodes that are
+ *        evaluated in one pass when assigned to a MyMatrix
  */
 template <typename T>
-class MyMatrix
+class MyMatrix: public MyMatrixExpr<MyMatrix<T>, T>
 {
     private:
-        MyVector<T> *m_data; //! vector of vectors = matrix rep.
+        T *m_data; //! aligned row-major buffer of r rows, each m_stride long
         size_t r; //! the number of rows in the matrix
         size_t c; //! the number of columns in the matrix
+        size_t m_stride; //! elements between row starts (c padded to alignment)
+
+        /*! assign rows function, evaluates an expression into every row
+         * @brief assign rows helper, writes expr into the calling matrix
+         * @pre expr must be the same size as the calling matrix
+         * @param[in] expr expression node (or matrix) to evaluate
+         * @post writes every element of expr, bands of rows in parallel; if
+         *       expr reads the calling matrix through a transposed view it
+         *       is evaluated into new storage and swapped in instead
+         */
+        template <typename E>
+        void assign_rows(const E &expr);
+
+        /*! assign rows function, writes the transpose of a matrix
+         * @brief assign rows helper, transposes a viewed matrix into obj.
+         * @pre expr must be the same size as the calling matrix
+         * @param[in] expr transposed view of a matrix, may view the calling
+         *            matrix itself
+         * @post transposes cache obliviously, in place when expr views the
+         *       calling (then square) matrix, see MyTranspose.h
+         */
+        void assign_rows(const MyMatrixTransposed<MyMatrix<T>, T> &expr);
 
     public:
         /*!
@@ -143,7 +154,7 @@ class MyMatrix
          * @pre none
          * @post creates empty matrix object of size 0 x 0
          */
-        MyMatrix(): m_data(nullptr), r(0), c(0) {}
+        MyMatrix(): m_data(nullptr), r(0), c(0), m_stride(0) {}
 
         /*! Parameterized constructor, given a 2D initializer list
          * @brief param. constructor, create matrix given 2d initializer list
@@ -179,51 +190,86 @@ class MyMatrix
          */
         MyMatrix(const MyMatrix<T> &a);
 
+        /*! move constructor, takes over the storage of 'a'
+         * @brief move constructor, takes over storage of matrix 'a'
+         * @pre none
+         * @param[in,out] a matrix object whose storage is taken over
+         * @post creates an MyMatrix object owning a's storage, leaves 'a'
+         *       an empty 0 x 0 matrix
+         */
+        MyMatrix(MyMatrix<T> &&a) noexcept;
+
+        /*! expression constructor, evaluates a matrix expression
+         * @brief expression constructor, evaluates matrix expression e
+         * @pre none
+         * @param[in] e matrix expression (e.g. a + b * s) to evaluate
+         * @post creates MyMatrix of e's size, evaluating every element of e
+         *       in a single pass
+         */
+        template <typename E>
+        MyMatrix(const MyMatrixExpr<E, T> &e);
+
         /*! assignment operator, returns calling object after copied from 'a'
          * @brief assignment operator, copies 'a' object and returns new obj
          * @pre none
-         * @param[in] a matrix object to be copied to calling object
+         * @param[in] a matrix object to be copied to calling object, moved
+         *            (not copied) into when assigning from a temporary
          * @post creates a new MyMatrix object copied from 'a'
          * @returns the new equivalent MyMatrix object
          */
         MyMatrix<T>& operator=(MyMatrix<T> a);
 
+        /*! expression assignment, evaluates a matrix expression into obj.
+         * @brief expression assignment, evaluates matrix expression e
+         * @pre none
+         * @param[in] e matrix expression (e.g. a + b * s) to evaluate
+         * @post writes every element of e straight into the calling object,
+         *       reallocating only if the size differs; e may refer to the
+         *       calling object, since element (i, j) only depends on (i, j),
+         *       and a = transposed(a) is transposed in place; any other e
+         *       reading a through a transposed view is evaluated into new
+         *       storage first
+         * @returns the modified calling object
+         */
+        template <typename E>
+        MyMatrix<T>& operator=(const MyMatrixExpr<E, T> &e);
+
         /*! resize function, resizes matrix to be new_r x new_c,
          * @brief resize function to size (new_r x new_c)
-         * @pre new_r and new_c must be positive
+         * @pre none
          * @param[in] new_r amount of rows for new matrix
          * @param[in] new_c amount of cols for new matrix
-         * @throw std::out_of_range if new_r, new_c negative
-         * @post resize the matrix, getting rid of previous elements
+         * @post resize the matrix, getting rid of previous elements (zeroed)
          */
         void resize(const size_t new_r, const size_t new_c);
 
-        /*! subscript operator, returns vector in matrix at index i by copy
-         * @brief subscript operator, returns vector in matrix at index i
-         * @pre i must be a positive number (>0)
+        /*! subscript operator, returns read-only view of row at index i
+         * @brief subscript operator, returns read-only view of row at index i
+         * @pre i must be in range 0 <= i < rows()
          * @param[in] i a positive size_t to access MyMatrix from
-         * @throw std::invalid_argument if i is not positive
-         * @post accesses the vector at index i
-         * @returns copy of the accessed vector at index i
+         * @throw std::out_of_range if i >= rows() and BOUNDS_CHECKED
+         * @post accesses the row at index i
+         * @returns read-only view of the row at index i
          */
-        MyVector<T> operator[](const size_t i) const;
+        MyRowView<const T> operator[](const size_t i) const;
 
-        /*! subscript operator, returns reference to vector at index i
-         * @brief subscript operator, return ref. to vector at index i
-         * @pre i must be a positive number (>0)
+        /*! subscript operator, returns mutable view of row at index i
+         * @brief subscript operator, return mutable view of row at index i
+         * @pre i must be in range 0 <= i < rows()
          * @param[in] i a positive size_t to access MyMatrix from
-         * @throw std::invalid_argument if i is not positive
-         * @post accesses the vector at index i
-         * @returns reference to vector at index i
+         * @throw std::out_of_range if i >= rows() and BOUNDS_CHECKED
+         * @post accesses the row at index i
+         * @returns mutable view of the row at index i
          */
-        MyVector<T>& operator[](const size_t i);
+        MyRowView<T> operator[](const size_t i);
 
         /*! evaluation operator, returns copy of element at matrix[i][j]
          * @brief eval. operator, returns copy of element at matrix[i][j]
-         * @pre i and j must be positive numbers (>0)
+         * @pre i and j must be in range of the matrix
          * @param[in] i the index of the row to access in matrix
          * @param[in] j the index of the col to access in matrix
-         * @throw std::invalid_argument if i or j is not positive
+         * @throw std::out_of_range if i >= rows() or j >= cols(), and
+         *        BOUNDS_CHECKED
          * @post access the T value at index matrix[i][j]
          * @returns a copy of the accessed T value at matrix[i][j]
          */
@@ -231,15 +277,45 @@ class MyMatrix
 
         /*! evaluation operator, returns ref. of element at matrix[i][j]
          * @brief eval. operator, returns ref. of element at matrix[i][j]
-         * @pre i and j must be positive numbers (>0)
+         * @pre i and j must be in range of the matrix
          * @param[in] i the index of the row to access in matrix
          * @param[in] j the index of the col to access in matrix
-         * @throw std::invalid_argument if i or j is not positive
+         * @throw std::out_of_range if i >= rows() or j >= cols(), and
+         *        BOUNDS_CHECKED
          * @post access the T value at index matrix[i][j]
          * @returns a reference to the accessed T value at matrix[i][j]
          */
         T& operator()(const size_t i, const size_t j);
 
+        /*! elem function, returns copy of element at matrix[i][j], unchecked
+         * @brief elem function, returns matrix[i][j] without bounds checking
+         * @pre i and j must be in range of the matrix
+         * @param[in] i the index of the row to access in matrix
+         * @param[in] j the index of the col to access in matrix
+         * @post returns the element at (i, j), used by expression nodes
+         * @returns the element at (i, j)
+         */
+        const T& elem(const size_t i, const size_t j) const
+            { return m_data[i * m_stride + j]; }
+
+        /*! reads function, returns whether this matrix is matrix m
+         * @brief reads function, whether this matrix is m, for alias checks
+         * @pre none
+         * @param[in] m address of a matrix
+         * @post none
+         * @returns true if m is the address of the calling object
+         */
+        bool reads(const void *m) const { return this == m; }
+
+        /*! reads transposed function, a matrix has no transposed view
+         * @brief reads transposed function, false for a plain matrix
+         * @pre none
+         * @param[in] m address of a matrix
+         * @post none
+         * @returns false, element (i, j) is only ever element (i, j)
+         */
+        bool reads_transposed(const void *) const { return false; }
+
         /*! row function, returns the amount of rows in the matrix
          * @brief row function, returns the amount of rows in the matrix
          * @pre none
@@ -256,6 +332,50 @@ class MyMatrix
          */
         size_t cols() const { return c; }
 
+        /*! stride function, returns the distance between starts of rows
+         * @brief stride function, returns distance between starts of rows
+         * @pre none
+         * @post returns the padded row length of the storage buffer
+         * @returns the amount of T's between the starts of two adjacent rows
+         */
+        size_t stride() const { return m_stride; }
+
+        /*! data function, returns pointer to the contiguous storage buffer
+         * @brief data function, returns pointer to contiguous storage buffer
+         * @pre none
+         * @post returns pointer to element (0, 0), row i starts at i * stride()
+         * @returns pointer to the first element of the storage buffer
+         */
+        T* data() { return m_data; }
+
+        /*! data function, returns pointer to the contiguous storage buffer
+         * @brief data function, returns read-only ptr to contiguous storage
+         * @pre none
+         * @post returns pointer to element (0, 0), row i starts at i * stride()
+         * @returns pointer to the first element of the storage buffer
+         */
+        const T* data() const { return m_data; }
+
+        /*! row pointer function, returns pointer to row i, unchecked
+         * @brief row pointer function, returns pointer to start of row i
+         * @pre i must be in range 0 <= i < rows()
+         * @param[in] i the index of the row
+         * @post returns pointer to the cols() elements of row i; never
+         *       checks i, so kernels indexing it can be vectorized
+         * @returns pointer to element (i, 0)
+         */
+        T* row_ptr(const size_t i) { return m_data + i * m_stride; }
+
+        /*! row pointer function, returns pointer to row i, unchecked
+         * @brief row pointer function, returns read-only ptr to row i
+         * @pre i must be in range 0 <= i < rows()
+         * @param[in] i the index of the row
+         * @post returns pointer to the cols() elements of row i; never
+         *       checks i, so kernels indexing it can be vectorized
+         * @returns pointer to element (i, 0)
+         */
+        const T* row_ptr(const size_t i) const { return m_data + i * m_stride; }
+
         /*! unary minus, returns new matrix, all the elements are negative
          * @brief unary minus, returns new matrix with elements inverted
          * @pre type T must be capable of being made negative
@@ -264,39 +384,84 @@ class MyMatrix
          */
         MyMatrix<T>& operator-();
 
+        /*! addition assignment, adds matrix a to the calling matrix in place
+         * @brief addition assignment, adds matrix a to calling obj. in place
+         * @pre type T must be capable of addition, a is same size as call obj.
+         * @param[in] a matrix expression, rhs of addition
+         * @throw std::invalid_argument if a is a different size
+         * @post adds each element of a to the calling matrix, no allocation
+         *       unless a reads the calling matrix through a transposed view
+         * @returns the modified calling object
+         */
+        template <typename E>
+        MyMatrix<T>& operator+=(const MyMatrixExpr<E, T> &a);
+
+        /*! subtraction assignment, subtracts a from calling matrix in place
+         * @brief subtraction assignment, minus matrix a from call obj. in place
+         * @pre type T must be capable of subtraction, a is same size as call obj.
+         * @param[in] a matrix expression, rhs of subtraction
+         * @throw std::invalid_argument if a is a different size
+         * @post subtracts each element of a from calling matrix, no allocation
+         *       unless a reads the calling matrix through a transposed view
+         * @returns the modified calling object
+         */
+        template <typename E>
+        MyMatrix<T>& operator-=(const MyMatrixExpr<E, T> &a);
+
+        /*! multiplication assignment, scales the calling matrix in place
+         * @brief scalar mult. assignment, multiplies call obj. by b in place
+         * @pre type T must be capable of multiplication
+         * @param[in] b scalar value of type T to multiply every element by
+         * @post multiplies each element of the calling matrix by b
+         * @returns the modified calling object
+         */
+        MyMatrix<T>& operator*=(const T b);
+
         /*! identity helper function, create identity matrix same size as call
          * @brief identity function, creates identity matrix same size as call
          * @pre none
          * @post creates identity matrix with same size as calling object
-         * @returns identity matrix with same size as calling object with ints
+         * @returns identity matrix with same size as calling object
          */
-        MyMatrix<int> identity();
+        MyMatrix<T> identity() const;
 
         /*! transpose helper function, transposes the calling matrix
-         * @brief transpose helper function, transposes the calling matrix
+         * @brief transpose helper function, returns transpose of calling obj.
          * @pre none
-         * @post transposes the calling matrix
+         * @post builds the (cols x rows) transpose with the cache oblivious
+         *       transpose of MyTranspose.h, bands of rows in parallel; use
+         *       transposed(m) to read the transpose without building it
          * @returns a copy of this matrix transposed
          */
-        MyMatrix<T> transpose();
+        MyMatrix<T> transpose() const;
 
-        /*! invert function, performs matrix inversion based on newton-schulz
-         * @brief invert function, inverts matrix based on newton-schulz method
+        /*! transpose in place function, transposes the calling matrix
+         * @brief transpose in place, replaces calling obj. by its transpose
          * @pre none
-         * @post inverts the calling object using the newton-schulz method
+         * @post square matrices are transposed in place without allocating,
+         *       others are transposed into new (cols x rows) storage
+         * @returns the modified calling object
+         */
+        MyMatrix<T>& transpose_in_place();
+
+        /*! invert function, performs matrix inversion by lu decomposition
+         * @brief invert function, inverts matrix via MyLUDecomp
+         * @pre calling object must be square and not singular
+         * @throw std::invalid_argument if not square or singular
+         * @post factors the calling object with partial pivoting and solves
+         *       for the identity, O(n^3) whatever the entries are
          * @returns a new matrix equal to inverse of calling object
          */
         MyMatrix<T> invert() const;
 
         /*! swap function, swaps contents of a and b
          * @brief swap function, swaps contents of a and b
-         * @pre a and b must be matrices of same size
+         * @pre none
          * @param[in,out] a matrix object, lhs of the swap function
          * @param[in,out] b matrix object, rhs of the swap function
-         * @throw std::invalid_argument if a and b are not the same size
-         * @post swaps the matrix contents of a and b
+         * @post swaps the matrix contents (and sizes) of a and b
          */
-        friend void swap<T>(MyMatrix<T> &a, MyMatrix<T> &b);
+        friend void swap<T>(MyMatrix<T> &a, MyMatrix<T> &b) noexcept;
 
         /*! extraction operator, outputs contents of src to console
          * @brief extraction operator, outputs contents of src to console
@@ -320,5 +485,6 @@ class MyMatrix
 };
 
 #include "MyMatrix.hpp"
+#include "../../common/MyLUDecomp.h"
 
 #endif
\ No newline at end of file
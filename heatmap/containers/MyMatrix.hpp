@@ -8,29 +8,23 @@ MyMatrix<T>::MyMatrix(const initializer_list<initializer_list<T>> &l)
             throw std::invalid_argument("init_list diff. sizes in matrix con");
     }
 
-    m_data = new MyVector<T>[l.size()];
-    for(size_t i = 0; i < l.size(); i++)
-        m_data[i] = MyVector<T>(l.begin()->size());
+    r = l.size();
+    c = init_list_size;
+    m_stride = padded_stride<T>(c);
+    m_data = aligned_new_array<T>(r * m_stride);
 
-    size_t curr_vect = 0;
+    size_t curr_row = 0;
     for(auto i = l.begin(); i != l.end(); i++)
     {
-        size_t curr_i = 0;
-        for(auto x = i->begin(); x != i->end(); x++)
-        {
-            m_data[curr_vect][curr_i] = *x;
-            curr_i++;
-        }
-        curr_vect++;
+        std::copy(i->begin(), i->end(), m_data + curr_row * m_stride);
+        curr_row++;
     }
-    r = l.size();
-    c = l.begin()->size();
 }
 
 template <typename T>
 MyMatrix<T>::~MyMatrix()
 {
-    delete[] m_data;
+    aligned_delete_array(m_data, r * m_stride);
     m_data = nullptr;
 }
 
@@ -40,46 +34,104 @@ MyMatrix<T>::MyMatrix(const size_t rows, const size_t cols)
     if(rows <= 0 || cols <= 0)
         throw std::invalid_argument("matrix constr. given neg. size");
 
-    m_data = new MyVector<T>[rows];
-    for(size_t i = 0; i < rows; i++)
-        m_data[i] = MyVector<T>(cols);
+    // one aligned allocation for the whole matrix, value-initialized to zero
     r = rows;
     c = cols;
-
-    for(size_t i = 0; i < rows; i++)
-    {
-        for(size_t j = 0; j < cols; j++)
-            operator[](i).operator[](j) = 0;
-    }
+    m_stride = padded_stride<T>(cols);
+    m_data = aligned_new_array<T>(r * m_stride);
 }
 
 template <typename T>
 MyMatrix<T>::MyMatrix(const MyMatrix<T> &a)
 {
-    m_data = new MyVector<T>[a.rows()];
-    for(size_t i = 0; i < a.rows(); i++)
-        m_data[i] = MyVector<T>(a.cols());
-
     r = a.rows();
     c = a.cols();
+    m_stride = a.stride();
+    m_data = aligned_new_array<T>(r * m_stride);
+    std::copy(a.m_data, a.m_data + r * m_stride, m_data);
+}
 
-    for(size_t i = 0; i < r; i++)
+template <typename T>
+MyMatrix<T>::MyMatrix(MyMatrix<T> &&a) noexcept: m_data(a.m_data), r(a.r),
+    c(a.c), m_stride(a.m_stride)
+{
+    a.m_data = nullptr;
+    a.r = 0;
+    a.c = 0;
+    a.m_stride = 0;
+}
+
+template <typename T>
+template <typename E>
+MyMatrix<T>::MyMatrix(const MyMatrixExpr<E, T> &e)
+{
+    const E &expr = e.self();
+    r = expr.rows();
+    c = expr.cols();
+    m_stride = padded_stride<T>(c);
+    m_data = aligned_new_array<T>(r * m_stride);
+    assign_rows(expr);
+}
+
+template <typename T>
+template <typename E>
+MyMatrix<T>& MyMatrix<T>::operator=(const MyMatrixExpr<E, T> &e)
+{
+    const E &expr = e.self();
+    if(expr.rows() != r || expr.cols() != c)
     {
-        for(size_t j = 0; j < c; j++)
-            m_data[i][j] = a[i][j];
+        // the expression may read this matrix, so evaluate it before the
+        // old storage is released
+        MyMatrix<T> evaluated(e);
+        swap(*this, evaluated);
+        return *this;
     }
+    assign_rows(expr);
+    return *this;
 }
 
 template <typename T>
-void swap(MyMatrix<T> &a, MyMatrix<T> &b)
+template <typename E>
+void MyMatrix<T>::assign_rows(const E &expr)
 {
-    if(a.rows() != b.rows() || a.cols() != b.cols())
-        throw std::invalid_argument("swap function a size DNE b size");
-    for(size_t i = 0; i < a.rows(); i++)
+    // a transposed view of this matrix reads elements other rows are still
+    // to overwrite, so such an expression is evaluated into new storage
+    if(expr.reads_transposed(this))
     {
-        for(size_t j = 0; j < a.cols(); j++)
-            std::swap(a.m_data[i][j], b.m_data[i][j]);
+        MyMatrix<T> evaluated(expr);
+        swap(*this, evaluated);
+        return;
     }
+
+    parallel_for(r, c, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+        {
+            T *row = m_data + i * m_stride;
+            for(size_t j = 0; j < c; j++)
+                row[j] = expr.elem(i, j);
+        }
+    });
+}
+
+template <typename T>
+void MyMatrix<T>::assign_rows(const MyMatrixTransposed<MyMatrix<T>, T> &expr)
+{
+    const MyMatrix<T> &src = expr.operand();
+    if(&src == this)
+        transpose_square(r, m_data, m_stride);
+    else
+        transpose_parallel(src.r, src.c, src.m_data, src.m_stride, m_data,
+            m_stride);
+}
+
+template <typename T>
+void swap(MyMatrix<T> &a, MyMatrix<T> &b) noexcept
+{
+    std::swap(a.m_data, b.m_data);
+    std::swap(a.r, b.r);
+    std::swap(a.c, b.c);
+    std::swap(a.m_stride, b.m_stride);
 }
 
 template <typename T>
@@ -92,54 +144,42 @@ MyMatrix<T>& MyMatrix<T>::operator=(MyMatrix<T> a)
 template <typename T>
 void MyMatrix<T>::resize(const size_t new_r, const size_t new_c)
 {
-    if(new_r < 0 || new_c < 0)
-        throw std::invalid_argument("matrix resize given neg. size");
-
-    delete[] m_data;
+    aligned_delete_array(m_data, r * m_stride);
 
-    m_data = new MyVector<T>[new_r];
-    for(size_t i = 0; i < new_r; i++)
-        m_data[i] = MyVector<T>(new_c);
     r = new_r;
     c = new_c;
-
-    for(size_t i = 0; i < new_r; i++)
-    {
-        for(size_t j = 0; j < new_c; j++)
-            operator[](i).operator[](j) = 0;
-    }
+    m_stride = padded_stride<T>(new_c);
+    m_data = aligned_new_array<T>(r * m_stride);
 }
 
 template <typename T>
-MyVector<T> MyMatrix<T>::operator[](const size_t i) const
+MyRowView<const T> MyMatrix<T>::operator[](const size_t i) const
 {
-    if(i < 0)
-        throw std::invalid_argument("[i] for matrix is negative");
-    return m_data[i];
+    check_index(i, r, "[i] for matrix is out of range");
+    return MyRowView<const T>(m_data + i * m_stride, c);
 }
 
 template <typename T>
-MyVector<T>& MyMatrix<T>::operator[](const size_t i)
+MyRowView<T> MyMatrix<T>::operator[](const size_t i)
 {
-    if(i < 0)
-        throw std::invalid_argument("[i] for matrix is negative");
-    return *&m_data[i];
+    check_index(i, r, "[i] for matrix is out of range");
+    return MyRowView<T>(m_data + i * m_stride, c);
 }
 
 template <typename T>
 T MyMatrix<T>::operator()(const size_t i, const size_t j) const
 {
-    if(i < 0 || j < 0)
-        throw std::invalid_argument("negative index for matrix(i, j) call");
-    return m_data[i][j];
+    check_index(i, r, "index out of range for matrix(i, j) call");
+    check_index(j, c, "index out of range for matrix(i, j) call");
+    return m_data[i * m_stride + j];
 }
 
 template <typename T>
 T& MyMatrix<T>::operator()(const size_t i, const size_t j)
 {
-    if(i < 0 || j < 0)
-        throw std::invalid_argument("negative index for matrix(i, j) call");
-    return *&m_data[i][j];
+    check_index(i, r, "index out of range for matrix(i, j) call");
+    check_index(j, c, "index out of range for matrix(i, j) call");
+    return m_data[i * m_stride + j];
 }
 
 template <typename T>
@@ -147,12 +187,72 @@ MyMatrix<T>& MyMatrix<T>::operator-()
 {
     for(size_t i = 0; i < rows(); i++)
     {
+        T *row = m_data + i * m_stride;
         for(size_t j = 0; j < cols(); j++)
-            operator[](i).operator[](j) *= -1;
+            row[j] *= -1;
     }
     return *this;
 }
 
+template <typename T>
+template <typename E>
+MyMatrix<T>& MyMatrix<T>::operator+=(const MyMatrixExpr<E, T> &a)
+{
+    if(a.rows() != rows() || a.cols() != cols())
+        throw std::invalid_argument("cant add matrices, different sizes");
+    if(a.reads_transposed(this))
+        return *this += MyMatrix<T>(a);
+
+    const E &e = a.self();
+    parallel_for(r, c, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+        {
+            T *row = m_data + i * m_stride;
+            for(size_t j = 0; j < c; j++)
+                row[j] += e.elem(i, j);
+        }
+    });
+    return *this;
+}
+
+template <typename T>
+template <typename E>
+MyMatrix<T>& MyMatrix<T>::operator-=(const MyMatrixExpr<E, T> &a)
+{
+    if(a.rows() != rows() || a.cols() != cols())
+        throw std::invalid_argument("cant minus matrices, different sizes");
+    if(a.reads_transposed(this))
+        return *this -= MyMatrix<T>(a);
+
+    const E &e = a.self();
+    parallel_for(r, c, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+        {
+            T *row = m_data + i * m_stride;
+            for(size_t j = 0; j < c; j++)
+                row[j] -= e.elem(i, j);
+        }
+    });
+    return *this;
+}
+
+template <typename T>
+MyMatrix<T>& MyMatrix<T>::operator*=(const T b)
+{
+    parallel_for(r, c, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+        {
+            T *row = m_data + i * m_stride;
+            for(size_t j = 0; j < c; j++)
+                row[j] *= b;
+        }
+    });
+    return *this;
+}
+
 template <typename T>
 ostream& operator<<(ostream &out, const MyMatrix<T> &src)
 {
@@ -182,21 +282,6 @@ istream& operator>>(istream &in, MyMatrix<T> &src)
     return in;
 }
 
-template <typename T>
-MyMatrix<T> operator+(const MyMatrix<T> &a, const MyMatrix<T> &b)
-{
-    if(a.rows() != b.rows() || a.cols() != b.cols())
-        throw std::invalid_argument("cant add matrices, different sizes");
-
-    MyMatrix<T> added_matrix(a.rows(), a.cols());
-    for(size_t i = 0; i < a.rows(); i++)
-    {
-        for(size_t j = 0; j < a.cols(); j++)
-            added_matrix[i][j] = a[i][j] + b[i][j];
-    }
-    return added_matrix;
-}
-
 MyMatrix<float> operator+(const MyMatrix<int> &a, const MyMatrix<float> &b)
 {
     if(a.rows() != b.rows() || a.cols() != b.cols())
@@ -211,21 +296,6 @@ MyMatrix<float> operator+(const MyMatrix<int> &a, const MyMatrix<float> &b)
     return added_matrix;
 }
 
-template <typename T>
-MyMatrix<T> operator-(const MyMatrix<T> &a, const MyMatrix<T> &b)
-{
-    if(a.rows() != b.rows() || a.cols() != b.cols())
-        throw std::invalid_argument("cant minus matrices, different sizes");
-
-    MyMatrix<T> added_matrix(a.rows(), a.cols());
-    for(size_t i = 0; i < a.rows(); i++)
-    {
-        for(size_t j = 0; j < a.cols(); j++)
-            added_matrix[i][j] = a[i][j] - b[i][j];
-    }
-    return added_matrix;
-}
-
 MyMatrix<float> operator-(const MyMatrix<int> &a, const MyMatrix<float> &b)
 {
     if(a.rows() != b.rows() || a.cols() != b.cols())
@@ -240,42 +310,20 @@ MyMatrix<float> operator-(const MyMatrix<int> &a, const MyMatrix<float> &b)
     return added_matrix;
 }
 
-template <typename T>
-MyMatrix<T> operator*(const MyMatrix<T> &a, const MyMatrix<T> &b)
+template <typename L, typename R, typename T>
+MyMatrix<T> operator*(const MyMatrixExpr<L, T> &lhs, const MyMatrixExpr<R, T> &rhs)
 {
-    if(a.cols() != b.rows())
+    if(lhs.cols() != rhs.rows())
         throw std::invalid_argument("cant mult. matrices, incompat. sizes");
-    
-    MyMatrix<T> product(a.rows(), b.cols());
-    for(size_t i = 0; i < product.rows(); i++)
-    {
-        for(size_t j = 0; j < product.cols(); j++)
-        {
-            T curr_sum = 0;
-            for(size_t curr_i = 0; curr_i < a.cols(); curr_i++)
-                curr_sum += (a[i][curr_i] * b[curr_i][j]);
-            product[i][j] = curr_sum;
-        }
-    }
-    return product;
-}
 
-template <typename T>
-MyMatrix<T> operator*(const T a, const MyMatrix<T> &b)
-{
-    return (b * a);
-}
+    const MyMatrix<T> &a = materialize(lhs.self());
+    const MyMatrix<T> &b = materialize(rhs.self());
 
-template <typename T>
-MyMatrix<T> operator*(const MyMatrix<T> &a, const T b)
-{
-    MyMatrix<T> scaled_matrix(a);
-    for(size_t i = 0; i < a.rows(); i++)
-    {
-        for(size_t j = 0; j < a.cols(); j++)
-            scaled_matrix[i][j] *= b;
-    }
-    return scaled_matrix;
+    // cache blocked, and vectorized for float and double, see MyGemm.h
+    MyMatrix<T> product(a.rows(), b.cols());
+    gemm(a.rows(), b.cols(), a.cols(), a.data(), a.stride(), b.data(),
+        b.stride(), product.data(), product.stride());
+    return product;
 }
 
 template <typename T>
@@ -285,12 +333,13 @@ MyMatrix<T> operator*(const MyVector<T> &a, const MyMatrix<T> &b)
         throw std::invalid_argument("cant mult. matrix/vect, incompat. sizes");
     
     MyMatrix<T> product(1, b.cols());
-    for(size_t i = 0; i < product.cols(); i++)
+    T *prod_row = product.data();
+    for(size_t curr_r = 0; curr_r < a.size(); curr_r++)
     {
-        T curr_sum = 0;
-        for(size_t curr_r = 0; curr_r < a.size(); curr_r++)
-            curr_sum += (a[curr_r] * b[curr_r][i]);
-        product[0][i] = curr_sum;
+        const T a_val = a[curr_r];
+        const T *b_row = b.data() + curr_r * b.stride();
+        for(size_t i = 0; i < product.cols(); i++)
+            prod_row[i] += a_val * b_row[i];
     }
     return product;
 }
@@ -301,21 +350,27 @@ MyVector<T> operator*(const MyMatrix<T> &a, const MyVector<T> &b)
     if(a.cols() != b.size())
         throw std::invalid_argument("cant mult. vect/matrix, incompat. sizes");
     
-    MyVector<T> product(b.size());
-    for(size_t i = 0; i < product.size(); i++)
+    MyVector<T> product(a.rows());
+    const T *b_data = b.data();
+    T *prod_data = product.data();
+    parallel_for(a.rows(), a.cols(), [&](const size_t lo, const size_t hi)
     {
-        T curr_sum = 0;
-        for(size_t curr_r = 0; curr_r < a.cols(); curr_r++)
-            curr_sum += (a[i][curr_r] * b[curr_r]);
-        product[i] = curr_sum;
-    }
+        for(size_t i = lo; i < hi; i++)
+        {
+            const T *a_row = a.data() + i * a.stride();
+            T curr_sum = 0;
+            for(size_t curr_r = 0; curr_r < a.cols(); curr_r++)
+                curr_sum += (a_row[curr_r] * b_data[curr_r]);
+            prod_data[i] = curr_sum;
+        }
+    });
     return product;
 }
 
 template <typename T>
-MyMatrix<int> MyMatrix<T>::identity()
+MyMatrix<T> MyMatrix<T>::identity() const
 {
-    MyMatrix<int> iden(rows(), cols());
+    MyMatrix<T> iden(rows(), cols());
     for(size_t i = 0; i < rows(); i++)
     {
         for(size_t j = 0; j < cols(); j++)
@@ -330,105 +385,21 @@ MyMatrix<int> MyMatrix<T>::identity()
 }
 
 template <typename T>
-MyMatrix<T> MyMatrix<T>::transpose()
+MyMatrix<T> MyMatrix<T>::transpose() const
 {
-    MyMatrix<T> this_copy(*this);
-    for(size_t i = 0; i < rows(); i++)
-    {
-        for(size_t j = 0; j < rows(); j++)
-            this_copy[j][i] = operator[](i).operator[](j);
-    }
-    return this_copy;
+    return MyMatrix<T>(transposed(*this));
 }
 
 template <typename T>
-MyMatrix<T> MyMatrix<T>::invert() const
+MyMatrix<T>& MyMatrix<T>::transpose_in_place()
 {
-    T row_sum, col_sum;
-
-    T sum = 0;
-    for(size_t i = 0; i < rows(); i++)
-    {
-        for(size_t j = 0; j < cols(); j++)
-            sum += m_data[i][j];
-        if(i == 0 || sum > row_sum)
-            row_sum = sum;
-    }
-    sum = 0;
-    for(size_t j = 0; j < cols(); j++)
-    {
-        for(size_t i = 0; i < rows(); i++)
-            sum += m_data[i][j];
-        if(j == 0 || sum > col_sum)
-            col_sum = sum;
-    }
-
-    T t = 1 / (row_sum * col_sum);
-    MyMatrix<T> this_transpose(*this);
-    this_transpose.transpose();
-
-    MyMatrix<T> b = t * this_transpose;
-    bool is_accurate = false;
-    while(!is_accurate)
-    {
-        MyMatrix<T> e = this_transpose.identity() - (b * *this);
-        b = (this_transpose.identity() + e) * b;
-
-        is_accurate = true;
-        for(size_t i = 0; i < b.rows(); i++)
-        {
-            for(size_t j = 0; j < b.cols(); j++)
-            {
-                if(b[i][j] > 0.001)
-                    is_accurate = false;
-            }
-        }
-    }
-    return b;
+    // square: assign_rows swaps across the diagonal in place; otherwise the
+    // size differs and operator= evaluates into new storage first
+    return *this = transposed(*this);
 }
 
-template <>
-MyMatrix<float> MyMatrix<float>::invert() const
+template <typename T>
+MyMatrix<T> MyMatrix<T>::invert() const
 {
-    float row_sum, col_sum;
-
-    float sum = 0;
-    for(size_t i = 0; i < rows(); i++)
-    {
-        for(size_t j = 0; j < cols(); j++)
-            sum += m_data[i][j];
-        if(i == 0 || sum > row_sum)
-            row_sum = sum;
-    }
-    sum = 0;
-    for(size_t j = 0; j < cols(); j++)
-    {
-        for(size_t i = 0; i < rows(); i++)
-            sum += m_data[i][j];
-        if(j == 0 || sum > col_sum)
-            col_sum = sum;
-    }
-
-    float t = 1.0 / (row_sum * col_sum);
-    MyMatrix<float> this_transpose(*this);
-    this_transpose.transpose();
-
-    MyMatrix<float> b = t * this_transpose;
-    bool is_accurate = false;
-    while(!is_accurate)
-    {
-        MyMatrix<float> e = (this_transpose.identity() - (b * *this));
-        b = (this_transpose.identity() + e) * b;
-
-        is_accurate = true;
-        for(size_t i = 0; i < b.rows(); i++)
-        {
-            for(size_t j = 0; j < b.cols(); j++)
-            {
-                if(b[i][j] > 0.001)
-                    is_accurate = false;
-            }
-        }
-    }
-    return b;
-}
\ No newline at end of file
+    return MyLUDecomp<T>(*this).inverse();
+}
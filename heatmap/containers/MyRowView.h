@@ -0,0 +1,99 @@
+#ifndef MY_ROW_VIEW_H
+#define MY_ROW_VIEW_H
+
+#include <stdexcept>
+#include <type_traits>
+#include "MyVector.h"
+#include "../../common/MyIterator.h"
+#include "../../common/MyBoundsCheck.h"
+
+/*! row view class, non-owning view of one row of a MyMatrix
+ * @brief MyRowView class, lightweight reference to one row of a matrix,
+ *        use MyRowView<const T> for read-only rows
+ */
+template <typename T>
+class MyRowView
+{
+    private:
+        T *m_row; //! pointer to first element of the viewed row
+        size_t m_size; //! amount of elements in the viewed row
+
+    public:
+        /*! Parameterized constructor, given row pointer and row length
+         * @brief param. constructor, given pointer to row and its length
+         * @pre row must point to at least n valid T's
+         * @param[in] row pointer to first element of the row
+         * @param[in] n amount of elements in the row
+         * @post creates a view of the n elements starting at row
+         */
+        MyRowView(T *row, const size_t n): m_row(row), m_size(n) {}
+
+        /*! Conversion constructor, creates read-only view from mutable view
+         * @brief conversion constructor, makes const view from mutable view
+         * @pre none
+         * @param[in] v mutable row view to view as read-only
+         * @post creates a view of the same row as v
+         */
+        template <typename U, typename = typename std::enable_if<
+            std::is_same<const U, T>::value>::type>
+        MyRowView(const MyRowView<U> &v): m_row(v.data()), m_size(v.size()) {}
+
+        /*! Size function, returns the length of the viewed row
+         * @brief Size function, returns length of viewed row
+         * @pre none
+         * @post returns the amount of elements in the row
+         * @returns the amount of elements in the row
+         */
+        size_t size() const { return m_size; }
+
+        /*! Data function, returns pointer to first element of the row
+         * @brief Data function, returns pointer to first element of row
+         * @pre none
+         * @post returns the underlying row pointer
+         * @returns the underlying row pointer
+         */
+        T* data() const { return m_row; }
+
+        /*! Subscript operator, returns ref. to element j of the row
+         * @brief Subscript operator, returns ref. to element j of the row
+         * @pre j must be in range 0 <= j < size()
+         * @param[in] j size_t representing column index in the row
+         * @throw std::out_of_range if j >= size() and BOUNDS_CHECKED
+         * @post returns a reference to element j of the row
+         * @returns the reference to element j of the row
+         */
+        T& operator[](const size_t j) const
+        {
+            check_index(j, m_size, "j is not in range of matrix row");
+            return m_row[j];
+        }
+
+        /*! begin() function, returns iter at beginning of the row
+         * @brief begin() function, returns iter at beginning of the row
+         * @pre none
+         * @post returns an iterator to beginning of the row
+         * @returns an iterator to beginning of the row
+         */
+        MyIterator<T> begin() const { return MyIterator<T>(m_row); }
+
+        /*! end() function, returns iter at end of the row
+         * @brief end() function, returns iter at end of the row
+         * @pre none
+         * @post returns an iterator to end of the row
+         * @returns an iterator to end of the row
+         */
+        MyIterator<T> end() const { return MyIterator<T>(m_row + m_size); }
+
+        /*! Conversion operator, copies the viewed row into a MyVector
+         * @brief conversion operator, copies viewed row into a new MyVector
+         * @pre none
+         * @post copies every element of the row into a new vector
+         * @returns the new vector holding a copy of the row
+         */
+        operator MyVector<typename std::remove_const<T>::type>() const
+        {
+            return MyVector<typename std::remove_const<T>::type>(m_row, m_size);
+        }
+};
+
+#endif
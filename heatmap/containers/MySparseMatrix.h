@@ -0,0 +1,315 @@
+#ifndef MY_SPARSE_MATRIX_H
+#define MY_SPARSE_MATRIX_H
+
+#include <type_traits>
+#include "MyVector.h"
+#include "../../common/MyBoundsCheck.h"
+#include "MyMatrix.h"
+
+/*! sparse matrix class, matrix stored in compressed sparse row (CSR) form
+ * @brief MySparseMatrix class, CSR matrix storing only nonzero entries
+ */
+template <typename T>
+class MySparseMatrix;
+
+/*! extraction operator, outputs stored entries of src to console
+ * @brief extraction operator, outputs stored entries of src to console
+ * @pre none
+ * @param[in,out] out ostream object to output with
+ * @param[in] src sparse matrix object to be outputted to console
+ * @post outputs one "i j value" line per stored entry of src
+ * @returns the modified ostream object
+ */
+template <typename T>
+ostream& operator<<(ostream &out, const MySparseMatrix<T> &src);
+
+/*! swap function, swaps contents of a and b
+ * @brief swap function, swaps contents of a and b
+ * @pre none
+ * @param[in,out] a sparse matrix object, lhs of the swap function
+ * @param[in,out] b sparse matrix object, rhs of the swap function
+ * @post swaps the matrix contents (and sizes) of a and b
+ */
+template <typename T>
+void swap(MySparseMatrix<T> &a, MySparseMatrix<T> &b);
+
+/*! sparse matrix*vector multiplication, multiplies vector b by matrix a
+ * @brief sparse matrix*vector mult., multiplies vector b by matrix a
+ * @pre type T must be capable of multiplication, the cols of matrix a must
+ *      be equal to the elements in vector b
+ * @param[in] a sparse matrix to be multiplied by vector b
+ * @param[in] b vector to be multiplied by sparse matrix a
+ * @throw std::invalid_argument if a.cols() != b.size()
+ * @post multiplies the vector b by the sparse matrix a, touching only nonzeros
+ * @returns a new vector containing result of multiplication
+ */
+template <typename T>
+MyVector<T> operator*(const MySparseMatrix<T> &a, const MyVector<T> &b);
+
+/*! sparse row class, non-owning view of the stored entries of one CSR row
+ * @brief MySparseRow class, view of the (column, value) pairs of one row,
+ *        entries are sorted by column; use MySparseRow<const T> read-only
+ */
+template <typename T>
+class MySparseRow
+{
+    private:
+        const size_t *m_cols; //! column index of each stored entry
+        T *m_vals; //! value of each stored entry
+        size_t m_nnz; //! amount of stored entries in the row
+
+    public:
+        /*! Parameterized constructor, given column/value arrays of a row
+         * @brief param. constructor, given column and value arrays of a row
+         * @pre cols and vals must both point to at least n valid elements
+         * @param[in] cols column index of each stored entry
+         * @param[in] vals value of each stored entry
+         * @param[in] n amount of stored entries in the row
+         * @post creates a view of the n entries of the row
+         */
+        MySparseRow(const size_t *cols, T *vals, const size_t n):
+            m_cols(cols), m_vals(vals), m_nnz(n) {}
+
+        /*! Conversion constructor, creates read-only view from mutable view
+         * @brief conversion constructor, makes const view from mutable view
+         * @pre none
+         * @param[in] v mutable sparse row view to view as read-only
+         * @post creates a view of the same entries as v
+         */
+        template <typename U, typename = typename std::enable_if<
+            std::is_same<const U, T>::value>::type>
+        MySparseRow(const MySparseRow<U> &v):
+            m_cols(v.cols()), m_vals(v.values()), m_nnz(v.size()) {}
+
+        /*! Size function, returns the amount of stored entries in the row
+         * @brief Size function, returns amount of stored entries in row
+         * @pre none
+         * @post returns the amount of nonzeros stored in the row
+         * @returns the amount of nonzeros stored in the row
+         */
+        size_t size() const { return m_nnz; }
+
+        /*! col function, returns column index of stored entry k
+         * @brief col function, returns column index of stored entry k
+         * @pre k must be in range 0 <= k < size()
+         * @param[in] k index of the stored entry
+         * @post returns the column of stored entry k
+         * @returns the column of stored entry k
+         */
+        size_t col(const size_t k) const { return m_cols[k]; }
+
+        /*! value function, returns reference to value of stored entry k
+         * @brief value function, returns ref. to value of stored entry k
+         * @pre k must be in range 0 <= k < size()
+         * @param[in] k index of the stored entry
+         * @post returns a reference to the value of stored entry k
+         * @returns a reference to the value of stored entry k
+         */
+        T& value(const size_t k) const { return m_vals[k]; }
+
+        /*! cols function, returns the column index array of the row
+         * @brief cols function, returns column index array of the row
+         * @pre none
+         * @post returns pointer to the size() column indices of the row
+         * @returns pointer to the column indices of the row
+         */
+        const size_t* cols() const { return m_cols; }
+
+        /*! values function, returns the value array of the row
+         * @brief values function, returns value array of the row
+         * @pre none
+         * @post returns pointer to the size() values of the row
+         * @returns pointer to the values of the row
+         */
+        T* values() const { return m_vals; }
+
+        /*! Subscript operator, returns value of the row at column j
+         * @brief Subscript operator, returns value of the row at column j
+         * @pre none
+         * @param[in] j column of the row to look up
+         * @post binary searches the stored columns for j
+         * @returns the stored value at column j, or zero if none stored
+         */
+        typename std::remove_const<T>::type operator[](const size_t j) const;
+
+        /*! dot function, computes the dot product of the row with x
+         * @brief dot function, computes dot product of the row with x
+         * @pre x must be at least as long as the matrix has columns
+         * @param[in] x vector to compute dot product with
+         * @post adds products of every stored entry with matching x element
+         * @returns the dot product of the row and x
+         */
+        typename std::remove_const<T>::type dot(const MyVector<
+            typename std::remove_const<T>::type> &x) const;
+};
+
+/*! sparse matrix class, matrix stored in compressed sparse row (CSR) form
+ * @brief MySparseMatrix class, CSR matrix storing only nonzero entries
+ */
+template <typename T>
+class MySparseMatrix
+{
+    private:
+        MyVector<T> m_values; //! values of stored entries, row after row
+        MyVector<size_t> m_cols; //! column index of each stored entry
+        MyVector<size_t> m_row_ptr; //! offset of each row start, size r + 1
+        size_t r; //! the number of rows in the matrix
+        size_t c; //! the number of columns in the matrix
+        size_t m_nnz; //! the number of stored entries in the matrix
+        size_t m_rows_done; //! the number of rows finished by end_row()
+        size_t m_bandwidth; //! largest |i - j| over all stored entries (i, j)
+
+    public:
+        typedef MySparseRow<T> row_type; //! type of a (mutable) row view
+        typedef MySparseRow<const T> const_row_type; //! read-only row view
+
+        /*!
+         * @brief default constructor, create empty sparse matrix of size 0x0
+         * @pre none
+         * @post creates empty sparse matrix object of size 0 x 0
+         */
+        MySparseMatrix(): m_values(), m_cols(), m_row_ptr(1), r(0), c(0),
+            m_nnz(0), m_rows_done(0), m_bandwidth(0) { m_row_ptr[0] = 0; }
+
+        /*! Parameterized constructor, starts assembly of a rows x cols matrix
+         * @brief param. constructor, starts assembling a (rows x cols) matrix
+         * @pre rows and cols must be positive
+         * @param[in] rows the amount of rows in the matrix
+         * @param[in] cols the amount of columns in the matrix
+         * @param[in] nnz_per_row expected nonzeros per row, sizes storage
+         * @throw std::invalid_argument if rows or cols is not positive
+         * @post creates empty (rows x cols) matrix, filled row by row through
+         *       insert() and end_row()
+         */
+        MySparseMatrix(const size_t rows, const size_t cols,
+            const size_t nnz_per_row);
+
+        /*! Conversion constructor, compresses an existing dense matrix
+         * @brief conversion constructor, compresses existing dense matrix
+         * @pre none
+         * @param[in] a dense matrix to be compressed
+         * @post creates sparse matrix holding every nonzero entry of a
+         */
+        explicit MySparseMatrix(const MyMatrix<T> &a);
+
+        /*! copy constructor, given an existing sparse matrix 'a'
+         * @brief copy constructor, given existing sparse matrix 'a'
+         * @pre none
+         * @param[in] a sparse matrix object to be copied to calling object
+         * @post creates an MySparseMatrix object copied from 'a'
+         */
+        MySparseMatrix(const MySparseMatrix<T> &a);
+
+        /*! assignment operator, returns calling object after copied from 'a'
+         * @brief assignment operator, copies 'a' object and returns new obj
+         * @pre none
+         * @param[in] a sparse matrix object to be copied to calling object
+         * @post swaps contents of calling object and the copy 'a'
+         * @returns the modified calling object
+         */
+        MySparseMatrix<T>& operator=(MySparseMatrix<T> a);
+
+        /*! insert function, appends entry (current row, col) to the matrix
+         * @brief insert function, appends entry at col to the current row
+         * @pre assembly must not be finished, col must be less than cols()
+         * @param[in] col column of the new entry
+         * @param[in] val value of the new entry
+         * @throw std::out_of_range if col >= cols() or every row is finished
+         * @post appends (col, val) to the row currently being assembled
+         */
+        void insert(const size_t col, const T val);
+
+        /*! end row function, finishes the row currently being assembled
+         * @brief end row function, finishes row currently being assembled
+         * @pre not every row may already be finished
+         * @throw std::out_of_range if every row is already finished
+         * @post sorts the entries of the current row by column, summing
+         *       duplicates, and moves on to the next row; trims storage
+         *       once the last row is finished
+         */
+        void end_row();
+
+        /*! row function, returns the amount of rows in the matrix
+         * @brief row function, returns the amount of rows in the matrix
+         * @pre none
+         * @post returns the amount of the rows in the matrix
+         * @returns the amount of rows in the matrix
+         */
+        size_t rows() const { return r; }
+
+        /*! col function, returns the amount of columns in the matrix
+         * @brief col function, returns the amount of columns in the matrix
+         * @pre none
+         * @post returns the amount of the columns in the matrix
+         * @returns the amount of columns in the matrix
+         */
+        size_t cols() const { return c; }
+
+        /*! nnz function, returns the amount of stored entries in the matrix
+         * @brief nnz function, returns amount of stored entries in matrix
+         * @pre none
+         * @post returns the amount of stored (nonzero) entries
+         * @returns the amount of stored (nonzero) entries
+         */
+        size_t nnz() const { return m_nnz; }
+
+        /*! bandwidth function, returns the half bandwidth of the matrix
+         * @brief bandwidth function, returns half bandwidth of the matrix
+         * @pre none
+         * @post returns the largest distance of a stored entry from diagonal
+         * @returns the largest |i - j| over all stored entries (i, j)
+         */
+        size_t bandwidth() const { return m_bandwidth; }
+
+        /*! row access function, returns read-only view of row i
+         * @brief row access, returns read-only view of stored entries in row i
+         * @pre i must be in range 0 <= i < rows(), row i must be finished
+         * @param[in] i the index of the row to access
+         * @throw std::out_of_range if i >= rows() and BOUNDS_CHECKED
+         * @post accesses the stored entries of row i
+         * @returns read-only view of the stored entries of row i
+         */
+        MySparseRow<const T> operator[](const size_t i) const;
+
+        /*! row access function, returns view of row i with mutable values
+         * @brief row access, returns view of stored entries in row i
+         * @pre i must be in range 0 <= i < rows(), row i must be finished
+         * @param[in] i the index of the row to access
+         * @throw std::out_of_range if i >= rows() and BOUNDS_CHECKED
+         * @post accesses the stored entries of row i
+         * @returns view of stored entries of row i, values are mutable
+         */
+        MySparseRow<T> operator[](const size_t i);
+
+        /*! evaluation operator, returns copy of element at matrix[i][j]
+         * @brief eval. operator, returns copy of element at matrix[i][j]
+         * @pre i and j must be in range of the matrix
+         * @param[in] i the index of the row to access in matrix
+         * @param[in] j the index of the col to access in matrix
+         * @throw std::out_of_range if i >= rows() and BOUNDS_CHECKED
+         * @post looks up the entry at (i, j)
+         * @returns the stored value at (i, j), or zero if none stored
+         */
+        T operator()(const size_t i, const size_t j) const;
+
+        /*! to dense function, expands the calling matrix into a MyMatrix
+         * @brief to dense function, expands calling matrix into a MyMatrix
+         * @pre none
+         * @post creates a dense matrix with every stored entry of this matrix
+         * @returns the dense (rows x cols) equivalent of this matrix
+         */
+        MyMatrix<T> to_dense() const;
+
+        /*! swap function, swaps contents of a and b
+         * @brief swap function, swaps contents of a and b
+         * @pre none
+         * @param[in,out] a sparse matrix object, lhs of the swap function
+         * @param[in,out] b sparse matrix object, rhs of the swap function
+         * @post swaps the matrix contents (and sizes) of a and b
+         */
+        friend void swap<T>(MySparseMatrix<T> &a, MySparseMatrix<T> &b);
+};
+
+#include "MySparseMatrix.hpp"
+
+#endif
@@ -0,0 +1,254 @@
+template <typename T>
+typename std::remove_const<T>::type MySparseRow<T>::operator[](const size_t j) const
+{
+    size_t lo = 0;
+    size_t hi = m_nnz;
+    while(lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if(m_cols[mid] < j)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    if(lo < m_nnz && m_cols[lo] == j)
+        return m_vals[lo];
+    return 0;
+}
+
+template <typename T>
+typename std::remove_const<T>::type MySparseRow<T>::dot(const MyVector<
+    typename std::remove_const<T>::type> &x) const
+{
+    typename std::remove_const<T>::type sum = 0;
+    const typename std::remove_const<T>::type *x_data = x.data();
+    for(size_t k = 0; k < m_nnz; k++)
+        sum += m_vals[k] * x_data[m_cols[k]];
+    return sum;
+}
+
+template <typename T>
+MySparseMatrix<T>::MySparseMatrix(const size_t rows, const size_t cols,
+    const size_t nnz_per_row)
+{
+    if(rows <= 0 || cols <= 0)
+        throw std::invalid_argument("sparse matrix constr. given neg. size");
+
+    r = rows;
+    c = cols;
+    m_nnz = 0;
+    m_rows_done = 0;
+    m_bandwidth = 0;
+
+    // reserve room for the expected nonzeros up front, insert() only has
+    // to grow the storage if a row holds more entries than expected
+    size_t reserved = std::max(rows * nnz_per_row, size_t(1));
+    m_values = MyVector<T>(reserved);
+    m_cols = MyVector<size_t>(reserved);
+    m_row_ptr = MyVector<size_t>(rows + 1);
+    m_row_ptr[0] = 0;
+}
+
+template <typename T>
+MySparseMatrix<T>::MySparseMatrix(const MyMatrix<T> &a)
+{
+    r = a.rows();
+    c = a.cols();
+
+    // count nonzeros first so the storage is allocated exactly once
+    m_nnz = 0;
+    for(size_t i = 0; i < r; i++)
+    {
+        const T *a_row = a.data() + i * a.stride();
+        for(size_t j = 0; j < c; j++)
+            m_nnz += (a_row[j] != T(0)) ? 1 : 0;
+    }
+
+    m_values = MyVector<T>(m_nnz);
+    m_cols = MyVector<size_t>(m_nnz);
+    m_row_ptr = MyVector<size_t>(r + 1);
+
+    size_t k = 0;
+    m_row_ptr[0] = 0;
+    m_bandwidth = 0;
+    for(size_t i = 0; i < r; i++)
+    {
+        const T *a_row = a.data() + i * a.stride();
+        for(size_t j = 0; j < c; j++)
+        {
+            if(a_row[j] != T(0))
+            {
+                m_values[k] = a_row[j];
+                m_cols[k] = j;
+                m_bandwidth = std::max(m_bandwidth, (i > j) ? i - j : j - i);
+                k++;
+            }
+        }
+        m_row_ptr[i + 1] = k;
+    }
+    m_rows_done = r;
+}
+
+template <typename T>
+MySparseMatrix<T>::MySparseMatrix(const MySparseMatrix<T> &a):
+    m_values(a.m_values), m_cols(a.m_cols), m_row_ptr(a.m_row_ptr), r(a.r),
+    c(a.c), m_nnz(a.m_nnz), m_rows_done(a.m_rows_done),
+    m_bandwidth(a.m_bandwidth) {}
+
+template <typename T>
+void swap(MySparseMatrix<T> &a, MySparseMatrix<T> &b)
+{
+    swap(a.m_values, b.m_values);
+    swap(a.m_cols, b.m_cols);
+    swap(a.m_row_ptr, b.m_row_ptr);
+    std::swap(a.r, b.r);
+    std::swap(a.c, b.c);
+    std::swap(a.m_nnz, b.m_nnz);
+    std::swap(a.m_rows_done, b.m_rows_done);
+    std::swap(a.m_bandwidth, b.m_bandwidth);
+}
+
+template <typename T>
+MySparseMatrix<T>& MySparseMatrix<T>::operator=(MySparseMatrix<T> a)
+{
+    swap(*this, a);
+    return *this;
+}
+
+template <typename T>
+void MySparseMatrix<T>::insert(const size_t col, const T val)
+{
+    if(m_rows_done >= r)
+        throw std::out_of_range("insert into finished sparse matrix");
+    if(col >= c)
+        throw std::out_of_range("col out of range for sparse insert");
+
+    // grow geometrically so a row longer than expected stays amortized O(1)
+    if(m_nnz == m_values.size())
+    {
+        m_values.resize(2 * m_nnz);
+        m_cols.resize(2 * m_nnz);
+    }
+    m_values[m_nnz] = val;
+    m_cols[m_nnz] = col;
+    m_nnz++;
+
+    size_t row = m_rows_done;
+    m_bandwidth = std::max(m_bandwidth, (row > col) ? row - col : col - row);
+}
+
+template <typename T>
+void MySparseMatrix<T>::end_row()
+{
+    if(m_rows_done >= r)
+        throw std::out_of_range("end_row on finished sparse matrix");
+
+    // insertion sort the (few) entries of this row by column
+    size_t row_start = m_row_ptr[m_rows_done];
+    for(size_t k = row_start + 1; k < m_nnz; k++)
+    {
+        size_t curr_col = m_cols[k];
+        T curr_val = m_values[k];
+        size_t pos = k;
+        while(pos > row_start && m_cols[pos - 1] > curr_col)
+        {
+            m_cols[pos] = m_cols[pos - 1];
+            m_values[pos] = m_values[pos - 1];
+            pos--;
+        }
+        m_cols[pos] = curr_col;
+        m_values[pos] = curr_val;
+    }
+
+    // merge entries inserted more than once at the same column
+    size_t last = row_start;
+    for(size_t k = row_start + 1; k < m_nnz; k++)
+    {
+        if(m_cols[k] == m_cols[last])
+            m_values[last] += m_values[k];
+        else
+        {
+            last++;
+            m_cols[last] = m_cols[k];
+            m_values[last] = m_values[k];
+        }
+    }
+    if(m_nnz > row_start)
+        m_nnz = last + 1;
+
+    m_rows_done++;
+    m_row_ptr[m_rows_done] = m_nnz;
+
+    // once the last row is done, drop the unused reserved storage
+    if(m_rows_done == r && m_values.size() != m_nnz)
+    {
+        m_values.resize(m_nnz);
+        m_cols.resize(m_nnz);
+    }
+}
+
+template <typename T>
+MySparseRow<const T> MySparseMatrix<T>::operator[](const size_t i) const
+{
+    check_index(i, r, "[i] for sparse matrix is out of range");
+    return MySparseRow<const T>(m_cols.data() + m_row_ptr[i],
+        m_values.data() + m_row_ptr[i], m_row_ptr[i + 1] - m_row_ptr[i]);
+}
+
+template <typename T>
+MySparseRow<T> MySparseMatrix<T>::operator[](const size_t i)
+{
+    check_index(i, r, "[i] for sparse matrix is out of range");
+    return MySparseRow<T>(m_cols.data() + m_row_ptr[i],
+        m_values.data() + m_row_ptr[i], m_row_ptr[i + 1] - m_row_ptr[i]);
+}
+
+template <typename T>
+T MySparseMatrix<T>::operator()(const size_t i, const size_t j) const
+{
+    return operator[](i)[j];
+}
+
+template <typename T>
+MyMatrix<T> MySparseMatrix<T>::to_dense() const
+{
+    MyMatrix<T> dense(r, c);
+    for(size_t i = 0; i < r; i++)
+    {
+        T *dense_row = dense.data() + i * dense.stride();
+        for(size_t k = m_row_ptr[i]; k < m_row_ptr[i + 1]; k++)
+            dense_row[m_cols[k]] = m_values[k];
+    }
+    return dense;
+}
+
+template <typename T>
+ostream& operator<<(ostream &out, const MySparseMatrix<T> &src)
+{
+    for(size_t i = 0; i < src.rows(); i++)
+    {
+        MySparseRow<const T> row = src[i];
+        for(size_t k = 0; k < row.size(); k++)
+            out << i << " " << row.col(k) << " " << row.value(k) << std::endl;
+    }
+    return out;
+}
+
+template <typename T>
+MyVector<T> operator*(const MySparseMatrix<T> &a, const MyVector<T> &b)
+{
+    if(a.cols() != b.size())
+        throw std::invalid_argument("cant mult. sparse/vect, incompat. sizes");
+
+    // the average stored entries per row weigh how many rows make a piece
+    // worth handing to another thread
+    MyVector<T> product(a.rows());
+    T *prod_data = product.data();
+    parallel_for(a.rows(), std::max(a.nnz() / std::max(a.rows(), size_t(1)),
+        size_t(1)), [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            prod_data[i] = a[i].dot(b);
+    });
+    return product;
+}
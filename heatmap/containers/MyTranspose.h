@@ -0,0 +1,177 @@
+#ifndef MY_TRANSPOSE_H
+#define MY_TRANSPOSE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include "../../common/MyThreadPool.h"
+
+/*! matrix transpose on row-major blocks of memory
+ *
+ * a straight double loop reads one matrix along rows and writes the other
+ * along columns, so for large matrices every write lands on a different
+ * cache line. these kernels instead halve the longer side of the block
+ * until it is at most TRANSPOSE_BLOCK on both sides and only then loop;
+ * at some level of that recursion a block of source and destination fits
+ * in every cache level, whatever the sizes of the caches are (cache
+ * oblivious). the out-of-place transpose hands bands of rows of the source
+ * to the shared container thread pool, the in-place square one bands of
+ * rows together with the matching columns.
+ */
+
+/*! side of the blocks the recursive transposes stop splitting at, a
+ *  source and destination block of doubles then fill half of a 32k L1
+ */
+const size_t TRANSPOSE_BLOCK = 32;
+
+/*! transpose block function, dst = transpose of src, recursively
+ * @brief transpose block, writes the transpose of a rows x cols block
+ * @pre src is rows x cols and dst is cols x rows, both row-major, and
+ *      they do not overlap
+ * @param[in] rows rows of src, columns of dst
+ * @param[in] cols columns of src, rows of dst
+ * @param[in] src first element of src
+ * @param[in] lds distance between rows of src, in elements
+ * @param[out] dst first element of dst
+ * @param[in] ldd distance between rows of dst, in elements
+ * @post dst[j][i] = src[i][j] for every element of src
+ */
+template <typename T>
+void transpose_block(const size_t rows, const size_t cols, const T *src,
+    const size_t lds, T *dst, const size_t ldd)
+{
+    if(rows <= TRANSPOSE_BLOCK && cols <= TRANSPOSE_BLOCK)
+    {
+        for(size_t i = 0; i < rows; i++)
+        {
+            const T *src_row = src + i * lds;
+            for(size_t j = 0; j < cols; j++)
+                dst[j * ldd + i] = src_row[j];
+        }
+    }
+    else if(rows >= cols)
+    {
+        const size_t half = rows / 2;
+        transpose_block(half, cols, src, lds, dst, ldd);
+        transpose_block(rows - half, cols, src + half * lds, lds, dst + half,
+            ldd);
+    }
+    else
+    {
+        const size_t half = cols / 2;
+        transpose_block(rows, half, src, lds, dst, ldd);
+        transpose_block(rows, cols - half, src + half, lds, dst + half * ldd,
+            ldd);
+    }
+}
+
+/*! transpose swap function, swaps block a with the transpose of block b
+ * @brief transpose swap, exchanges a[i][j] and b[j][i], recursively
+ * @pre a is rows x cols and b is cols x rows, sharing the row distance ld
+ *      and not overlapping
+ * @param[in] rows rows of a, columns of b
+ * @param[in] cols columns of a, rows of b
+ * @param[in,out] a first element of a
+ * @param[in,out] b first element of b
+ * @param[in] ld distance between rows of a and of b, in elements
+ * @post a holds the transpose of the old b and b the transpose of old a
+ */
+template <typename T>
+void transpose_swap(const size_t rows, const size_t cols, T *a, T *b,
+    const size_t ld)
+{
+    if(rows <= TRANSPOSE_BLOCK && cols <= TRANSPOSE_BLOCK)
+    {
+        for(size_t i = 0; i < rows; i++)
+        {
+            T *a_row = a + i * ld;
+            for(size_t j = 0; j < cols; j++)
+                std::swap(a_row[j], b[j * ld + i]);
+        }
+    }
+    else if(rows >= cols)
+    {
+        const size_t half = rows / 2;
+        transpose_swap(half, cols, a, b, ld);
+        transpose_swap(rows - half, cols, a + half * ld, b + half, ld);
+    }
+    else
+    {
+        const size_t half = cols / 2;
+        transpose_swap(rows, half, a, b, ld);
+        transpose_swap(rows, cols - half, a + half, b + half * ld, ld);
+    }
+}
+
+/*! transpose diagonal function, transposes a square block in place
+ * @brief transpose diagonal, transposes n x n block on the diagonal
+ * @pre a is n x n, row-major
+ * @param[in] n rows and columns of a
+ * @param[in,out] a first element of a
+ * @param[in] ld distance between rows of a, in elements
+ * @post a holds its own transpose; the two diagonal quarters recurse and
+ *       the off-diagonal quarters are swapped with transpose_swap
+ */
+template <typename T>
+void transpose_diagonal(const size_t n, T *a, const size_t ld)
+{
+    if(n <= TRANSPOSE_BLOCK)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            for(size_t j = i + 1; j < n; j++)
+                std::swap(a[i * ld + j], a[j * ld + i]);
+        }
+        return;
+    }
+    const size_t half = n / 2;
+    transpose_diagonal(half, a, ld);
+    transpose_diagonal(n - half, a + half * ld + half, ld);
+    transpose_swap(half, n - half, a + half, a + half * ld, ld);
+}
+
+/*! parallel transpose function, dst = transpose of src, bands in parallel
+ * @brief parallel transpose, out-of-place cache oblivious transpose
+ * @pre src is rows x cols and dst is cols x rows, both row-major, and
+ *      they do not overlap
+ * @param[in] rows rows of src, columns of dst
+ * @param[in] cols columns of src, rows of dst
+ * @param[in] src first element of src
+ * @param[in] lds distance between rows of src, in elements
+ * @param[out] dst first element of dst
+ * @param[in] ldd distance between rows of dst, in elements
+ * @post dst[j][i] = src[i][j]; a band of rows of src only writes the same
+ *       band of columns of dst, so bands never touch the same element
+ */
+template <typename T>
+void transpose_parallel(const size_t rows, const size_t cols, const T *src,
+    const size_t lds, T *dst, const size_t ldd)
+{
+    parallel_for(rows, cols, [&](const size_t lo, const size_t hi)
+    {
+        transpose_block(hi - lo, cols, src + lo * lds, lds, dst + lo, ldd);
+    });
+}
+
+/*! transpose square function, transposes a square matrix in place
+ * @brief transpose square, cache oblivious in-place square transpose
+ * @pre a is n x n, row-major
+ * @param[in] n rows and columns of a
+ * @param[in,out] a first element of a
+ * @param[in] ld distance between rows of a, in elements
+ * @post a holds its own transpose; a band of rows [lo, hi) transposes its
+ *       diagonal block and swaps the rest of its rows with the columns
+ *       [lo, hi) below it, which no other band touches
+ */
+template <typename T>
+void transpose_square(const size_t n, T *a, const size_t ld)
+{
+    parallel_for(n, n, [&](const size_t lo, const size_t hi)
+    {
+        transpose_diagonal(hi - lo, a + lo * ld + lo, ld);
+        transpose_swap(hi - lo, n - hi, a + lo * ld + hi, a + hi * ld + lo,
+            ld);
+    });
+}
+
+#endif
@@ -1,50 +1,55 @@
 template <typename T>
-MyVector<T>::MyVector(const std::initializer_list<T> &l)
-{
-    m_data = new T[l.size()];
-    m_size = l.size();
-    std::copy(l.begin(), l.end(), m_data);
-}
+MyVector<T>::MyVector(const std::initializer_list<T> &l): m_vec(l) {}
 
 template <typename T>
-MyVector<T>::MyVector(const size_t space)
-{
-    if(space < 0)
-        throw std::invalid_argument("m_size must be positive");
+MyVector<T>::MyVector(const size_t space): m_vec(space) {}
 
-    m_data = new T[space];
-    m_size = space;
-}
+template <typename T>
+MyVector<T>::MyVector(const T *arr, const size_t n): m_vec(arr, n) {}
 
 template <typename T>
-MyVector<T>::MyVector(const T *arr, const size_t n)
-{
-    m_size = n;
-    m_data = new T[m_size];
-    for(size_t i = 0; i < m_size; i++)
-        m_data[i] = arr[i];
-}
+MyVector<T>::MyVector(const MyVector<T> &src): m_vec(src.m_vec) {}
 
 template <typename T>
-MyVector<T>::~MyVector()
+template <typename E>
+MyVector<T>::MyVector(const MyVectorExpr<E, T> &e): m_vec(e.size())
 {
-    delete[] m_data;
+    const E &expr = e.self();
+    T *data = m_vec.data();
+    parallel_for(m_vec.size(), 1, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            data[i] = expr.elem(i);
+    });
 }
 
 template <typename T>
-MyVector<T>::MyVector(const MyVector<T> &src)
+template <typename E>
+MyVector<T>& MyVector<T>::operator=(const MyVectorExpr<E, T> &e)
 {
-    m_size = src.m_size;
-    m_data = new T[m_size];
-    for(size_t i = 0; i < m_size; i++)
-        m_data[i] = src.m_data[i];
+    const E &expr = e.self();
+    if(expr.size() != size())
+    {
+        // the expression may read this vector, so evaluate it before the
+        // old storage is released
+        MyVector<T> evaluated(e);
+        swap(*this, evaluated);
+        return *this;
+    }
+    T *data = m_vec.data();
+    parallel_for(size(), 1, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            data[i] = expr.elem(i);
+    });
+    return *this;
 }
 
 template <typename T>
 MyVector<T>& MyVector<T>::operator=(MyVector<T> src)
 {
-    if(src.size() != size())
-        resize(src.size());
+    // src is already a copy (or the moved temporary), so taking over its
+    // storage is enough, the old storage is freed along with src
     swap(*this, src);
     return *this;
 }
@@ -52,192 +57,115 @@ MyVector<T>& MyVector<T>::operator=(MyVector<T> src)
 template <typename T>
 void MyVector<T>::resize(const size_t new_size)
 {
-    if(new_size < 0)
-        throw std::invalid_argument("m_size must be positive");
-
-    size_t smaller_size = std::min(new_size, m_size);
-
-    T *m_data_copy = new T[smaller_size];
-    for(size_t i = 0; i < smaller_size; i++)
-        m_data_copy[i] = m_data[i];
-        
-    delete[] m_data;
-    m_data = new T[new_size];
-    for(size_t i = 0; i < smaller_size; i++)
-        m_data[i] = m_data_copy[i];
-
-    m_size = new_size;
-    delete[] m_data_copy;
+    m_vec.resize(new_size);
 }
 
 template <typename T>
 size_t MyVector<T>::size() const
 {
-    return m_size;
+    return m_vec.size();
 }
 
 template <typename T>
 MyVector<T>& MyVector<T>::apply(T(*func)(T))
 {
-    for(size_t i = 0; i < m_size; i++)
-        m_data[i] = func(m_data[i]);
+    m_vec.apply(func);
     return *this;
 }
 
 template <typename T>
 MyVector<T>& MyVector<T>::operator-()
 {
-    for(size_t i = 0; i < m_size; i++)
-        m_data[i] *= -1;
+    -m_vec;
     return *this;
 }
 
 template <typename T>
-T MyVector<T>::operator^(const int p) const
-{
-    T sum = 0;
-    for(size_t i = 0; i < m_size; i++)
-        sum += exp_by_squaring(m_data[i] < 0 ? -m_data[i] : m_data[i], p);
-    return sqrt_newton(double(sum), p);
-}
-
-template <typename T>
-T MyVector<T>::operator[](const size_t i) const
-{
-    if(i < 0 || i >= m_size)
-        throw std::out_of_range("i is not in range of vector");
-    return m_data[i];
-}
-
-template <typename T>
-T& MyVector<T>::operator[](const size_t i)
+template <typename E>
+MyVector<T>& MyVector<T>::operator+=(const MyVectorExpr<E, T> &rhs)
 {
-    if(i < 0 || i >= m_size)
-        throw std::out_of_range("i is not in range of vector");
-    return m_data[i];
-}
+    if(rhs.size() != size())
+        throw std::invalid_argument("lhs and rhs of += not same size");
 
-template <typename T>
-ostream& operator<<(ostream &out, const MyVector<T> &src)
-{
-    for(size_t i = 0; i < src.size() - 1; i++)
-        out << src[i] << " ";
-    if(src.size() != 0)
-        out << src[src.size() - 1];
-    return out;
+    const E &e = rhs.self();
+    T *data = m_vec.data();
+    parallel_for(size(), 1, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            data[i] += e.elem(i);
+    });
+    return *this;
 }
 
 template <typename T>
-istream& operator>>(istream &in, MyVector<T> &src)
+template <typename E>
+MyVector<T>& MyVector<T>::operator-=(const MyVectorExpr<E, T> &rhs)
 {
-    std::istream_iterator<T> eos;
-    std::istream_iterator<T> iit(in);
+    if(rhs.size() != size())
+        throw std::invalid_argument("lhs and rhs of -= not same size");
 
-    delete[] src.m_data;
-    src.resize(0);
-    int current_index = 0;
-
-    while(iit != eos)
+    const E &e = rhs.self();
+    T *data = m_vec.data();
+    parallel_for(size(), 1, [&](const size_t lo, const size_t hi)
     {
-        src.resize(src.size() + 1);
-        src.m_data[current_index] = *iit;
-        current_index++;
-        iit++;
-    }
-    
-    return in;
+        for(size_t i = lo; i < hi; i++)
+            data[i] -= e.elem(i);
+    });
+    return *this;
 }
 
 template <typename T>
-void swap(MyVector<T> &a, MyVector<T> &b)
+MyVector<T>& MyVector<T>::operator*=(const T &rhs)
 {
-    std::swap(a.m_size, b.m_size);
-    std::swap(a.m_data, b.m_data);
+    T *data = m_vec.data();
+    parallel_for(size(), 1, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            data[i] *= rhs;
+    });
+    return *this;
 }
 
 template <typename T>
-MyVector<T> operator+(const MyVector<T> &a, const MyVector<T> &b)
+T MyVector<T>::operator^(const int p) const
 {
-    if(a.size() != b.size())
-        throw std::invalid_argument("lhs and rhs of + not same size");
-
-    T *m_data_copy = new T[a.size()];
-    for(size_t i = 0; i < a.size(); i++)
-        m_data_copy[i] = a[i] + b[i];
-    
-    MyVector<T> new_vect(m_data_copy, a.size());
-    delete[] m_data_copy;
-    return new_vect;
+    const T *data = m_vec.data();
+    T sum = parallel_sum<T>(size(), 1, [&](const size_t lo, const size_t hi) -> T
+    {
+        T piece = 0;
+        for(size_t i = lo; i < hi; i++)
+            piece += exp_by_squaring(data[i] < 0 ? -data[i] : data[i], p);
+        return piece;
+    });
+    return sqrt_newton(double(sum), p);
 }
 
 template <typename T>
-MyVector<T> operator-(const MyVector<T> &a, const MyVector<T> &b)
+const T& MyVector<T>::operator[](const size_t i) const
 {
-    if(a.size() != b.size())
-        throw std::invalid_argument("lhs and rhs of - not same size");
-
-    T *m_data_copy = new T[a.size()];
-    for(size_t i = 0; i < a.size(); i++)
-        m_data_copy[i] = a[i] - b[i];
-    
-    MyVector<T> new_vect(m_data_copy, a.size());
-    delete[] m_data_copy;
-    return new_vect;
+    return m_vec[i];
 }
 
 template <typename T>
-MyVector<T> operator*(const MyVector<T> &lhs, const T &rhs)
+T& MyVector<T>::operator[](const size_t i)
 {
-    T *m_data_copy = new T[lhs.size()];
-    for(size_t i = 0; i < lhs.size(); i++)
-        m_data_copy[i] = lhs[i] * rhs;
-    
-    MyVector<T> new_vect(m_data_copy, lhs.size());
-    delete[] m_data_copy;
-    return new_vect;
+    return m_vec[i];
 }
 
 template <typename T>
-MyVector<T> operator*(const T lhs, const MyVector<T> &rhs)
+ostream& operator<<(ostream &out, const MyVector<T> &src)
 {
-    return (rhs * lhs);
+    return out << src.m_vec;
 }
 
 template <typename T>
-T operator*(const MyVector<T> &lhs, const MyVector<T> &rhs)
+istream& operator>>(istream &in, MyVector<T> &src)
 {
-    if(lhs.size() != rhs.size())
-        throw std::invalid_argument("lhs and rhs for * not of same size");
-
-    T sum = 0;
-    for(size_t i = 0; i < lhs.size(); i++)
-        sum += (lhs[i] * rhs[i]);
-    return sum;
+    return in >> src.m_vec;
 }
 
 template <typename T>
-T exp_by_squaring(const T x, const int n)
+void swap(MyVector<T> &a, MyVector<T> &b) noexcept
 {
-    if(n < 0)
-        return exp_by_squaring(1.0 / x, -n);
-    else if(n == 0)
-        return 1;
-    else if(n == 1)
-        return x;
-    else if(n % 2 == 0)
-        return exp_by_squaring(x * x, n / 2);
-    return x * exp_by_squaring(x * x, (n - 1) / 2);
+    swap(a.m_vec, b.m_vec);
 }
-
-template <typename T>
-T sqrt_newton(const T x, const int n)
-{
-    T xn = x;
-    T xn_next;
-    for(int i = 0; i < 10; i++)
-    {
-        xn_next = (1.0/n) * ((n-1)*xn + (x/exp_by_squaring(xn, n-1)));
-        xn = xn_next;
-    }
-    return xn_next;
-}
\ No newline at end of file
@@ -6,8 +6,9 @@ import sys
 
 '''
 @brief function to convert csv located at 'csv_path' to jpg at 'map_path'
-@pre csv_path must point to existing csv file
-@param[in] csv_path path, centered at current dir, to csv
+@pre csv_path must point to existing csv file, or an .npy file written by
+     the poisson driver, which loads without parsing any text
+@param[in] csv_path path, centered at current dir, to csv (or npy)
 @param[in] map_path path, centered at current dir, where jpg is desired to go
 @throw RuntimeError if given csv_path does not exist
 @post convert the supplied csv to a heatmap comparing csv's float values
@@ -16,7 +17,10 @@ def csv_to_heatmap(csv_path: str, map_path: str) -> None:
     if(not path.exists(csv_path)):
         raise RuntimeError('supplied csv_path doesnt exist')
 
-    data = np.genfromtxt(csv_path, delimiter=",")
+    if csv_path.endswith('.npy'):
+        data = np.load(csv_path)
+    else:
+        data = np.genfromtxt(csv_path, delimiter=",")
     figure = plt.figure()
     plt.imshow(data, cmap='hot', interpolation='nearest')
     plt.colorbar()
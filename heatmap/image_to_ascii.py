@@ -18,18 +18,20 @@ def rgb_to_bw(pixel: np.array) -> str:
 
 def image_to_array(image_path: str,
                    text_path: str = 'output.txt',
-                   size_threshold: int = 5000) -> None:
+                   size_threshold: int = 0) -> None:
     '''
     @brief Converts an image to a black-or-white ASCII representation,
     downscaling as necessary
     @param image_path: The filename of the input image
     @param text_path: The filename of the ASCII output
-    @param size_threshold: The max allowed matrix size
+    @param size_threshold: The max allowed matrix size, 0 (the default) keeps
+    the full resolution, which the multigrid solver handles in linear time
     @return The ASCII array (to be used in further processing)
     '''
     with Image.open(image_path) as image:
+        image = image.convert('RGB')
         matrix_size = image.size[0] * image.size[1]
-        if matrix_size > size_threshold:
+        if size_threshold > 0 and matrix_size > size_threshold:
                 scale_factor = math.sqrt(int(size_threshold) / matrix_size)
                 new_shape = (int(scale_factor * dim) for dim in image.size)
                 image = image.resize(new_shape)
@@ -38,9 +40,25 @@ def image_to_array(image_path: str,
     im_arr = np.apply_along_axis(rgb_to_bw, 2, im_arr)
     np.savetxt(text_path, im_arr, delimiter='', fmt='%c')
 
+def image_to_ppm(image_path: str, ppm_path: str) -> None:
+    '''
+    @brief Decodes an image into a binary PPM, which poisson_driver reads and
+    thresholds itself (at the same mean intensity of 200) without the text
+    round trip of image_to_array
+    @param image_path: The filename of the input image
+    @param ppm_path: The filename of the PPM output
+    '''
+    with Image.open(image_path) as image:
+        image.convert('RGB').save(ppm_path, format='PPM')
+
 if __name__ == '__main__':
-    if len(sys.argv) != 4:
-        print('Pass three arguments: input image path, output text path, and '
-        'matrix size threshold')
+    if len(sys.argv) not in (3, 4):
+        print('Pass two or three arguments: input image path, output text '
+        'path (or .ppm path), and optionally a matrix size threshold (0 for '
+        'full resolution)')
         raise RuntimeError('Wrong # of arguments')
-    image_to_array(sys.argv[1], sys.argv[2], int(sys.argv[3]))
+    threshold = int(sys.argv[3]) if len(sys.argv) == 4 else 0
+    if sys.argv[2].endswith('.ppm') and threshold == 0:
+        image_to_ppm(sys.argv[1], sys.argv[2])
+    else:
+        image_to_array(sys.argv[1], sys.argv[2], threshold)
@@ -0,0 +1,170 @@
+#ifndef IMAGE_INPUTTER_H
+#define IMAGE_INPUTTER_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <stdexcept>
+#include "../containers/MyVector.h"
+#include "../containers/MyBitMask.h"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#endif
+using std::string;
+
+/*! pixels whose mean r, g, b intensity (or gray level) is below this are
+ *  'B', the threshold image_to_ascii.py uses
+ */
+const unsigned MASK_THRESHOLD = 200;
+
+/*!
+ * @brief mask simd function, returns whether the avx2 kernels can run
+ * @pre none
+ * @post queries the cpu on the first call, later calls reuse the answer
+ * @returns true if the cpu supports avx2
+ */
+inline bool mask_use_avx2()
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    static const bool avx2 = __builtin_cpu_supports("avx2");
+    return avx2;
+#else
+    return false;
+#endif
+}
+
+/*!
+ * @brief gray threshold row function, packs one row of gray pixels
+ * @pre dst must hold ceil(cols / 64) words, from must be a multiple of 64
+ * @param[in] src cols 8 bit gray levels
+ * @param[in] cols number of pixels in the row
+ * @param[in] threshold gray levels below this become set bits
+ * @param[out] dst words of the mask row
+ * @param[in] from first pixel to pack, the ones before are left alone
+ * @post writes every word of dst from pixel from on, bit j set if
+ *       src[j] < threshold, the bits past cols 0
+ */
+void threshold_gray_row(const unsigned char *src, const size_t cols,
+    const unsigned threshold, uint64_t *dst, const size_t from = 0);
+
+/*!
+ * @brief rgb threshold row function, packs one row of rgb pixels
+ * @pre dst must hold ceil(cols / 64) words, from must be a multiple of 64
+ * @param[in] src 3 * cols bytes, r, g and b of each pixel
+ * @param[in] cols number of pixels in the row
+ * @param[in] threshold pixels whose mean intensity is below this become
+ *            set bits
+ * @param[out] dst words of the mask row
+ * @param[in] from first pixel to pack, the ones before are left alone
+ * @post writes every word of dst from pixel from on, bit j set if
+ *       r + g + b < 3 * threshold, the bits past cols 0
+ */
+void threshold_rgb_row(const unsigned char *src, const size_t cols,
+    const unsigned threshold, uint64_t *dst, const size_t from = 0);
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/*!
+ * @brief avx2 gray threshold row function, threshold_gray_row on 64 pixels
+ *        at a time; compares 32 bytes per instruction and moves the results
+ *        straight into mask bits
+ * @pre as threshold_gray_row, 0 < threshold <= 255, cpu supports avx2
+ * @param[in] src cols 8 bit gray levels
+ * @param[in] cols number of pixels in the row
+ * @param[in] threshold gray levels below this become set bits
+ * @param[out] dst words of the mask row
+ * @post same words as threshold_gray_row(src, cols, threshold, dst)
+ */
+__attribute__((target("avx2")))
+void threshold_gray_row_avx2(const unsigned char *src, const size_t cols,
+    const unsigned threshold, uint64_t *dst);
+
+/*!
+ * @brief avx2 rgb threshold row function, threshold_rgb_row on 64 pixels at
+ *        a time; splits 16 interleaved pixels into their channels with byte
+ *        shuffles, sums them in 16 bit lanes and moves the comparisons
+ *        straight into mask bits
+ * @pre as threshold_rgb_row, 0 < threshold <= 255, cpu supports avx2
+ * @param[in] src 3 * cols bytes, r, g and b of each pixel
+ * @param[in] cols number of pixels in the row
+ * @param[in] threshold pixels whose mean intensity is below this become
+ *            set bits
+ * @param[out] dst words of the mask row
+ * @post same words as threshold_rgb_row(src, cols, threshold, dst)
+ */
+__attribute__((target("avx2")))
+void threshold_rgb_row_avx2(const unsigned char *src, const size_t cols,
+    const unsigned threshold, uint64_t *dst);
+#endif
+
+/*!
+ * @brief gray threshold function, packs a decoded gray image into a mask
+ * @pre pixels must hold rows rows of cols bytes, stride bytes apart
+ * @param[in] pixels 8 bit gray levels, top row first
+ * @param[in] rows number of rows of the image
+ * @param[in] cols number of cols of the image
+ * @param[in] stride distance between the starts of two rows in bytes
+ * @param[in] threshold gray levels below this become 'B' pixels
+ * @post thresholds every pixel, with the avx2 kernel if the cpu has it
+ * @returns mask of the image, a set bit for every dark pixel
+ */
+MyBitMask threshold_gray(const unsigned char *pixels, const size_t rows,
+    const size_t cols, const size_t stride,
+    const unsigned threshold = MASK_THRESHOLD);
+
+/*!
+ * @brief rgb threshold function, packs a decoded rgb image into a mask
+ * @pre pixels must hold rows rows of 3 * cols bytes, stride bytes apart
+ * @param[in] pixels interleaved 8 bit r, g, b values, top row first
+ * @param[in] rows number of rows of the image
+ * @param[in] cols number of cols of the image
+ * @param[in] stride distance between the starts of two rows in bytes
+ * @param[in] threshold pixels whose mean intensity is below this become 'B'
+ * @post thresholds every pixel, with the avx2 kernel if the cpu has it
+ * @returns mask of the image, a set bit for every dark pixel
+ */
+MyBitMask threshold_rgb(const unsigned char *pixels, const size_t rows,
+    const size_t cols, const size_t stride,
+    const unsigned threshold = MASK_THRESHOLD);
+
+/*!
+ * @brief pnm header function, reads the next number of a pnm header
+ * @pre none
+ * @param[in] file contents of the image file
+ * @param[in,out] pos position to read from, moved past the number
+ * @param[in] path name of the image file, for the error message
+ * @throw std::invalid_argument if no number follows pos, or if it is above
+ *        2^24
+ * @post skips whitespace and # comments, then reads one decimal number
+ * @returns the number read
+ */
+size_t read_pnm_field(const string &file, size_t &pos, const string &path);
+
+/*!
+ * @brief pnm check function, returns whether path names a pnm image
+ * @pre none
+ * @param[in] path name of the input file
+ * @post none
+ * @returns true if path ends in .pgm, .ppm or .pnm
+ */
+bool is_pnm_path(const string &path);
+
+/*!
+ * @brief pnm read function, reads a binary pgm or ppm image into a mask
+ * @pre path must be a binary (P5 or P6) pgm or ppm file
+ * @param[in] path name of the image file
+ * @param[in] threshold pixels whose mean intensity is below this become
+ *            'B', on a 0 to 255 scale whatever the maxval of the file
+ * @throw std::invalid_argument if path cannot be read, is not a binary pgm
+ *        or ppm, or is truncated
+ * @post reads the file in one block and thresholds its pixels in place;
+ *       files with a maxval other than 255 are scaled to 8 bits first
+ * @returns mask with one row per row of the image, top row first
+ */
+MyBitMask read_pnm_mask(const string &path,
+    const unsigned threshold = MASK_THRESHOLD);
+
+#include "ImageInputter.hpp"
+
+#endif
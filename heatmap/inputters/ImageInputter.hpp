@@ -0,0 +1,241 @@
+void threshold_gray_row(const unsigned char *src, const size_t cols,
+    const unsigned threshold, uint64_t *dst, const size_t from)
+{
+    for(size_t k = from / MASK_WORD_BITS; k * MASK_WORD_BITS < cols; k++)
+    {
+        const size_t start = k * MASK_WORD_BITS;
+        const size_t end = std::min(cols, start + MASK_WORD_BITS);
+        uint64_t word = 0;
+        for(size_t j = start; j < end; j++)
+            word |= uint64_t(src[j] < threshold) << (j - start);
+        dst[k] = word;
+    }
+}
+
+void threshold_rgb_row(const unsigned char *src, const size_t cols,
+    const unsigned threshold, uint64_t *dst, const size_t from)
+{
+    const unsigned limit = 3 * threshold;
+    for(size_t k = from / MASK_WORD_BITS; k * MASK_WORD_BITS < cols; k++)
+    {
+        const size_t start = k * MASK_WORD_BITS;
+        const size_t end = std::min(cols, start + MASK_WORD_BITS);
+        uint64_t word = 0;
+        for(size_t j = start; j < end; j++)
+        {
+            const unsigned sum = unsigned(src[3 * j]) + src[3 * j + 1] +
+                src[3 * j + 2];
+            word |= uint64_t(sum < limit) << (j - start);
+        }
+        dst[k] = word;
+    }
+}
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+__attribute__((target("avx2")))
+void threshold_gray_row_avx2(const unsigned char *src, const size_t cols,
+    const unsigned threshold, uint64_t *dst)
+{
+    // v < threshold exactly when min(v, threshold - 1) == v
+    const __m256i top = _mm256_set1_epi8(char(threshold - 1));
+    size_t j = 0;
+    for(; j + MASK_WORD_BITS <= cols; j += MASK_WORD_BITS)
+    {
+        const __m256i lo = _mm256_loadu_si256((const __m256i*)(src + j));
+        const __m256i hi = _mm256_loadu_si256((const __m256i*)(src + j + 32));
+        const uint32_t lo_bits = uint32_t(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_min_epu8(lo, top), lo)));
+        const uint32_t hi_bits = uint32_t(_mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_min_epu8(hi, top), hi)));
+        dst[j / MASK_WORD_BITS] = uint64_t(lo_bits) | (uint64_t(hi_bits) << 32);
+    }
+    threshold_gray_row(src, cols, threshold, dst, j);
+}
+
+__attribute__((target("avx2")))
+void threshold_rgb_row_avx2(const unsigned char *src, const size_t cols,
+    const unsigned threshold, uint64_t *dst)
+{
+    // 16 pixels are 48 bytes, read as three 16 byte blocks; byte p of the
+    // control of channel ch for block b picks byte 3p + ch - 16b of that
+    // block into lane p, or zero if that byte lies in another block
+    __m128i control[3][3];
+    for(int ch = 0; ch < 3; ch++)
+    {
+        for(int b = 0; b < 3; b++)
+        {
+            alignas(16) char bytes[16];
+            for(int p = 0; p < 16; p++)
+            {
+                const int at = 3 * p + ch - 16 * b;
+                bytes[p] = (at >= 0 && at < 16) ? char(at) : char(0x80);
+            }
+            control[ch][b] = _mm_load_si128((const __m128i*)bytes);
+        }
+    }
+
+    const __m128i limit = _mm_set1_epi16(short(3 * threshold));
+    const __m128i zero = _mm_setzero_si128();
+    size_t j = 0;
+    for(; j + MASK_WORD_BITS <= cols; j += MASK_WORD_BITS)
+    {
+        uint64_t word = 0;
+        for(size_t g = 0; g < MASK_WORD_BITS / 16; g++)
+        {
+            const unsigned char *p = src + 3 * (j + 16 * g);
+            const __m128i block[3] = {
+                _mm_loadu_si128((const __m128i*)p),
+                _mm_loadu_si128((const __m128i*)(p + 16)),
+                _mm_loadu_si128((const __m128i*)(p + 32))};
+
+            // sums of up to 765 need 16 bit lanes, 8 pixels per register
+            __m128i sum_lo = zero;
+            __m128i sum_hi = zero;
+            for(int ch = 0; ch < 3; ch++)
+            {
+                const __m128i channel = _mm_or_si128(_mm_or_si128(
+                    _mm_shuffle_epi8(block[0], control[ch][0]),
+                    _mm_shuffle_epi8(block[1], control[ch][1])),
+                    _mm_shuffle_epi8(block[2], control[ch][2]));
+                sum_lo = _mm_add_epi16(sum_lo, _mm_unpacklo_epi8(channel, zero));
+                sum_hi = _mm_add_epi16(sum_hi, _mm_unpackhi_epi8(channel, zero));
+            }
+            const __m128i dark = _mm_packs_epi16(_mm_cmplt_epi16(sum_lo, limit),
+                _mm_cmplt_epi16(sum_hi, limit));
+            word |= uint64_t(uint32_t(_mm_movemask_epi8(dark))) << (16 * g);
+        }
+        dst[j / MASK_WORD_BITS] = word;
+    }
+    threshold_rgb_row(src, cols, threshold, dst, j);
+}
+#endif
+
+MyBitMask threshold_gray(const unsigned char *pixels, const size_t rows,
+    const size_t cols, const size_t stride, const unsigned threshold)
+{
+    MyBitMask mask(rows, cols);
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if(mask_use_avx2() && threshold > 0 && threshold <= 255)
+    {
+        for(size_t i = 0; i < rows; i++)
+            threshold_gray_row_avx2(pixels + i * stride, cols, threshold,
+                mask.row_ptr(i));
+        return mask;
+    }
+#endif
+    for(size_t i = 0; i < rows; i++)
+        threshold_gray_row(pixels + i * stride, cols, threshold,
+            mask.row_ptr(i));
+    return mask;
+}
+
+MyBitMask threshold_rgb(const unsigned char *pixels, const size_t rows,
+    const size_t cols, const size_t stride, const unsigned threshold)
+{
+    MyBitMask mask(rows, cols);
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    if(mask_use_avx2() && threshold > 0 && threshold <= 255)
+    {
+        for(size_t i = 0; i < rows; i++)
+            threshold_rgb_row_avx2(pixels + i * stride, cols, threshold,
+                mask.row_ptr(i));
+        return mask;
+    }
+#endif
+    for(size_t i = 0; i < rows; i++)
+        threshold_rgb_row(pixels + i * stride, cols, threshold,
+            mask.row_ptr(i));
+    return mask;
+}
+
+size_t read_pnm_field(const string &file, size_t &pos, const string &path)
+{
+    while(pos < file.size())
+    {
+        if(file[pos] == '#')
+            pos = std::min(file.find('\n', pos), file.size());
+        else if(std::isspace((unsigned char)file[pos]))
+            pos++;
+        else
+            break;
+    }
+
+    // no header value may exceed 2^24, so rows * cols * channels * 2 (the
+    // byte size of the pixels) cannot overflow
+    size_t val = 0;
+    const size_t start = pos;
+    for(; pos < file.size() && std::isdigit((unsigned char)file[pos]); pos++)
+    {
+        val = 10 * val + size_t(file[pos] - '0');
+        if(val > (size_t(1) << 24))
+            throw std::invalid_argument("pnm header value too large: " + path);
+    }
+    if(pos == start)
+        throw std::invalid_argument("malformed pnm header: " + path);
+    return val;
+}
+
+bool is_pnm_path(const string &path)
+{
+    const string extension = path.substr(std::min(path.rfind('.'),
+        path.size()));
+    return extension == ".pgm" || extension == ".ppm" || extension == ".pnm";
+}
+
+MyBitMask read_pnm_mask(const string &path, const unsigned threshold)
+{
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if(!in)
+        throw std::invalid_argument("cant open image: " + path);
+    string file(size_t(in.tellg()), '\0');
+    in.seekg(0);
+    in.read(&file[0], std::streamsize(file.size()));
+    if(!in)
+        throw std::invalid_argument("cant read image: " + path);
+
+    // P5 is a binary graymap, P6 a binary pixmap; the ascii variants and
+    // bitmaps are rare enough to leave to a conversion tool
+    size_t channels = 0;
+    if(file.compare(0, 2, "P5") == 0)
+        channels = 1;
+    else if(file.compare(0, 2, "P6") == 0)
+        channels = 3;
+    else
+        throw std::invalid_argument("image is not a binary pgm or ppm: " + path);
+
+    size_t pos = 2;
+    const size_t cols = read_pnm_field(file, pos, path);
+    const size_t rows = read_pnm_field(file, pos, path);
+    const size_t maxval = read_pnm_field(file, pos, path);
+    if(maxval == 0 || maxval > 65535)
+        throw std::invalid_argument("pnm maxval out of range: " + path);
+    if(pos >= file.size() || !std::isspace((unsigned char)file[pos]))
+        throw std::invalid_argument("malformed pnm header: " + path);
+    pos++; // a single whitespace char separates the header and the pixels
+
+    const size_t sample_bytes = (maxval < 256) ? 1 : 2;
+    const size_t samples = rows * cols * channels;
+    if(file.size() - pos < samples * sample_bytes)
+        throw std::invalid_argument("pnm image data truncated: " + path);
+
+    const unsigned char *data = (const unsigned char*)file.data() + pos;
+    if(maxval != 255)
+    {
+        // rescale to 8 bits so the threshold means the same for every
+        // maxval; 16 bit samples are stored big-endian
+        MyVector<unsigned char> scaled(samples);
+        for(size_t s = 0; s < samples; s++)
+        {
+            const size_t v = (sample_bytes == 1) ? data[s] :
+                (size_t(data[2 * s]) << 8) | data[2 * s + 1];
+            scaled[s] = (unsigned char)((std::min(v, maxval) * 255 +
+                maxval / 2) / maxval);
+        }
+        return (channels == 1) ?
+            threshold_gray(scaled.data(), rows, cols, cols, threshold) :
+            threshold_rgb(scaled.data(), rows, cols, 3 * cols, threshold);
+    }
+    return (channels == 1) ?
+        threshold_gray(data, rows, cols, cols, threshold) :
+        threshold_rgb(data, rows, cols, 3 * cols, threshold);
+}
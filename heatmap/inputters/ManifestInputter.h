@@ -0,0 +1,102 @@
+#ifndef MANIFEST_INPUTTER_H
+#define MANIFEST_INPUTTER_H
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <stdexcept>
+#include "../containers/MyVector.h"
+using std::string;
+
+/*! method letters the driver knows: cholesky, sor, adaptive sor, red-black
+ *  sor, conjugate gradient and multigrid
+ */
+const string POISSON_METHODS = "CSARGM";
+
+/*! poisson job struct, one solve of a batch
+ * @brief poisson job struct, the grid to read, the method to solve it with
+ *        and the file to write the solution to
+ */
+struct PoissonJob
+{
+    string input; //! b/w text grid or pgm/ppm image to solve on
+    char method; //! one of POISSON_METHODS
+    double tolerance; //! stopping tolerance, 0 for the method's default
+    string output; //! solution file, the extension picks the format
+    size_t line; //! line of the manifest the job came from, from 1
+
+    /*!
+     * @brief default constructor, creates an empty cholesky job
+     * @pre none
+     * @post creates poissonjob object without input or output
+     */
+    PoissonJob(): input(), method('C'), tolerance(0), output(), line(0) {}
+};
+
+/*!
+ * @brief method check function, returns whether method names a solver
+ * @pre none
+ * @param[in] method letter of a method
+ * @post none
+ * @returns true if method is one of POISSON_METHODS
+ */
+inline bool is_poisson_method(const char method)
+{
+    return POISSON_METHODS.find(method) != string::npos;
+}
+
+/*!
+ * @brief method read function, parses the method field of a job
+ * @pre none
+ * @param[in] field the field, a single method letter
+ * @param[in] where prefix of error messages, naming the field's origin
+ * @throw std::invalid_argument if field is not one of POISSON_METHODS
+ * @post none
+ * @returns the method letter
+ */
+char read_method(const string &field, const string &where);
+
+/*!
+ * @brief tolerance read function, parses the tolerance field of a job
+ * @pre none
+ * @param[in] field the field, a positive number or - for the default
+ * @param[in] where prefix of error messages, naming the field's origin
+ * @throw std::invalid_argument if field is neither - nor a positive,
+ *        finite number
+ * @post none
+ * @returns the tolerance, 0 for -
+ */
+double read_tolerance(const string &field, const string &where);
+
+/*!
+ * @brief manifest line function, parses one line of a job manifest
+ * @pre none
+ * @param[in] text the line, without its newline
+ * @param[in] line number of the line, for error messages
+ * @param[out] job the job on the line, untouched if there is none
+ * @throw std::invalid_argument if the line is neither blank, a comment nor
+ *        a valid job
+ * @post a job is "input method [tolerance] output", whitespace separated;
+ *       a tolerance of - (or none) keeps the method's default, and
+ *       everything after a # is a comment
+ * @returns true if the line held a job
+ */
+bool read_manifest_line(const string &text, const size_t line, PoissonJob &job);
+
+/*!
+ * @brief manifest read function, reads every job of a job manifest
+ * @pre none
+ * @param[in] path name of the manifest file
+ * @throw std::invalid_argument if path cannot be read, a line is malformed,
+ *        or two jobs write the same output
+ * @post reads the manifest line by line, see read_manifest_line
+ * @returns the jobs in the order the manifest lists them
+ */
+MyVector<PoissonJob> read_manifest(const string &path);
+
+#include "ManifestInputter.hpp"
+
+#endif
@@ -0,0 +1,72 @@
+char read_method(const string &field, const string &where)
+{
+    if(field.size() != 1 || !is_poisson_method(field[0]))
+        throw std::invalid_argument(where + "unknown method " + field +
+            ", expected one of " + POISSON_METHODS);
+    return field[0];
+}
+
+double read_tolerance(const string &field, const string &where)
+{
+    if(field == "-")
+        return 0;
+    char *end = nullptr;
+    const double tolerance = std::strtod(field.c_str(), &end);
+    if(field.empty() || *end != '\0' || !(tolerance > 0) ||
+        !std::isfinite(tolerance))
+        throw std::invalid_argument(where + "tolerance " + field +
+            " is not a positive number");
+    return tolerance;
+}
+
+bool read_manifest_line(const string &text, const size_t line, PoissonJob &job)
+{
+    const string where = "manifest line " + std::to_string(line) + ": ";
+    std::istringstream fields(text.substr(0, text.find('#')));
+    MyVector<string> field;
+    string word;
+    while(fields >> word)
+        field.push_back(word);
+
+    if(field.size() == 0)
+        return false;
+    if(field.size() != 3 && field.size() != 4)
+        throw std::invalid_argument(where +
+            "expected input, method, [tolerance,] output");
+    const char method = read_method(field[1], where);
+    const double tolerance = (field.size() == 4) ?
+        read_tolerance(field[2], where) : 0;
+
+    job.input = field[0];
+    job.method = method;
+    job.tolerance = tolerance;
+    job.output = field[field.size() - 1];
+    job.line = line;
+    return true;
+}
+
+MyVector<PoissonJob> read_manifest(const string &path)
+{
+    std::ifstream in(path);
+    if(!in)
+        throw std::invalid_argument("cant open manifest: " + path);
+
+    MyVector<PoissonJob> jobs;
+    std::map<string, size_t> writer; // line of the job writing each output
+    PoissonJob job;
+    string text;
+    for(size_t line = 1; std::getline(in, text); line++)
+    {
+        if(!read_manifest_line(text, line, job))
+            continue;
+        // jobs run concurrently, two writing one file would race
+        if(writer.count(job.output) != 0)
+            throw std::invalid_argument("manifest line " +
+                std::to_string(line) + ": output " + job.output +
+                " already written by line " +
+                std::to_string(writer[job.output]));
+        writer[job.output] = line;
+        jobs.push_back(job);
+    }
+    return jobs;
+}
@@ -3,6 +3,7 @@
 
 #include "../containers/MyMatrix.h"
 #include "../containers/MyVector.h"
+#include "../containers/MySparseMatrix.h"
 #include <cmath>
 
 /*!
@@ -30,13 +31,35 @@ void swap(CholeskyDecomp &a, CholeskyDecomp &b);
 ostream& operator<<(ostream &out, const CholeskyDecomp &cd);
 
 /*!
- * @brief cholesky decomp class, a functor to wrap around decomposed matrix
+ * @brief cholesky decomp class, a functor to wrap around decomposed matrix,
+ *        the factor L is stored in skyline (profile) form: row i of L only
+ *        keeps columns first_col[i] through i, since entries left of the
+ *        first nonzero of a row of A stay zero during factorization
  */
 class CholeskyDecomp
 {
     private:
-        MyMatrix<double> A; //! cholesky decomposed matrix A
-        int n; //! number of rows (and cols) of double matrix A
+        MyVector<double> L; //! profile of each row of factor L, row after row
+        MyVector<size_t> row_start; //! offset of row i of L, size n + 1
+        MyVector<size_t> first_col; //! first stored column of each row of L
+        int n; //! number of rows (and cols) of decomposed matrix
+        size_t half_band; //! largest distance of a stored entry from diagonal
+
+        /*!
+         * @brief helper function, sizes the profile storage from first_col
+         * @pre first_col must hold n entries, first_col[i] <= i
+         * @post sets row_start from first_col, allocates zeroed profile L
+         */
+        void allocate_profile();
+
+        /*!
+         * @brief helper function, factors the profile stored in L in place
+         * @pre L must hold the lower triangle of an spd matrix in profile form
+         * @throw std::invalid_argument if the matrix is not positive definite
+         * @post overwrites L with the cholesky factor, in O(n * b^2) time for
+         *       half bandwidth b
+         */
+        void decompose_profile();
 
     public:
         /*!
@@ -44,15 +67,30 @@ class CholeskyDecomp
          * @pre none
          * @post creates choleskydecomp object with size 0
          */
-        CholeskyDecomp(): A(MyMatrix<double>()), n(0) {}
+        CholeskyDecomp(): L(), row_start(1), first_col(), n(0), half_band(0)
+            { row_start[0] = 0; }
 
         /*!
          * @brief param. constructor, given existing nxn matrix m
          * @pre matrix m must be able to be cholesky decomposed
          * @param[in] m matrix to be converted to cholesky object
-         * @post creates choleskydecomp object given existing matrix m
+         * @throw std::invalid_argument if m is not square or not positive definite
+         * @post creates choleskydecomp object given existing matrix m, storing
+         *       only the profile of m's lower triangle
+         */
+        explicit CholeskyDecomp(const MyMatrix<double> &m) { factorize(m); }
+
+        /*!
+         * @brief param. constructor, given existing sparse nxn matrix m
+         * @pre matrix m must be able to be cholesky decomposed
+         * @param[in] m sparse matrix to be converted to cholesky object
+         * @throw std::invalid_argument if m is not square or not positive definite
+         * @post creates choleskydecomp object given existing sparse matrix m,
+         *       for a banded matrix of half bandwidth b this takes O(n * b^2)
+         *       time and O(n * b) memory
          */
-        explicit CholeskyDecomp(const MyMatrix<double> &m);
+        explicit CholeskyDecomp(const MySparseMatrix<double> &m)
+            { factorize(m); }
 
         /*!
          * @brief copy constructor, given existing choleskydecomp object
@@ -72,45 +110,68 @@ class CholeskyDecomp
         CholeskyDecomp& operator=(CholeskyDecomp &cd);
 
         /*!
-         * @brief eval operator, solves matrix equation Ax=b efficiently
-         *        using upper and triangle matrices to reduce time complexity
+         * @brief factorize function, replaces the stored factor with that of m
+         * @pre matrix m must be able to be cholesky decomposed
+         * @param[in] m matrix to be decomposed
+         * @throw std::invalid_argument if m is not square or not positive definite
+         * @post stores the profile of the cholesky factor of m, later calls
+         *       to solve() reuse it without refactoring
+         */
+        void factorize(const MyMatrix<double> &m);
+
+        /*!
+         * @brief factorize function, replaces the stored factor with that of m
+         * @pre matrix m must be able to be cholesky decomposed
+         * @param[in] m sparse matrix to be decomposed
+         * @throw std::invalid_argument if m is not square or not positive definite
+         * @post stores the profile of the cholesky factor of m, later calls
+         *       to solve() reuse it without refactoring
+         */
+        void factorize(const MySparseMatrix<double> &m);
+
+        /*!
+         * @brief solve function, solves matrix equation Ax=b with stored factor
          * @pre matrix A and vector b must have equal number of rows
          * @param[in] b b vector of equation Ax = b
          * @throw std::invalid_argument if b and A have different sizes
-         * @post performs double back substitution to solve for x
+         * @post performs forward and back substitution with L to solve for x,
+         *       O(n * b) for half bandwidth b; the factor is not modified
          * @returns a vector representing x values
          */
-        MyVector<double> operator()(MyVector<double> b);
+        MyVector<double> solve(MyVector<double> b) const;
 
         /*!
-         * @brief helper function, decomposes a matrix, stores result in l
-         * @pre a and l must be matrices of the same size
-         * @param[in] a original matrix, to be decomposed
-         * @param[out] l result matrix, stores decomposed result
-         * @throw std::invalid_argument if a, l are different sizes
-         * @post decomposes matrix a via cholesky decomposition, stores in l
+         * @brief solve function, solves AX=B for every column of B at once
+         * @pre matrix A and matrix B must have equal number of rows
+         * @param[in] B matrix whose columns are the b vectors of Ax = b
+         * @throw std::invalid_argument if B and A have different row counts
+         * @post performs both substitutions for all columns in one pass over
+         *       L, each entry of L updates a whole (contiguous) row of X
+         * @returns a matrix whose column k is the solution for column k of B
          */
-        void decompose(const MyMatrix<double> &a, MyMatrix<double> &l);
+        MyMatrix<double> solve(MyMatrix<double> B) const;
 
         /*!
-         * @brief const access operator, access vector in matrix A at index i
-         * @pre i must be in range of matrix A
-         * @param[in] i matrix index to access
-         * @throw std::out_of_range if i out of range of matrix A
-         * @post access the matrix vector at index i
-         * @returns the accessed matrix vector at index i
+         * @brief eval operator, solves matrix equation Ax=b efficiently
+         *        using upper and triangle matrices to reduce time complexity
+         * @pre matrix A and vector b must have equal number of rows
+         * @param[in] b b vector of equation Ax = b
+         * @throw std::invalid_argument if b and A have different sizes
+         * @post performs double back substitution to solve for x
+         * @returns a vector representing x values
          */
-        MyVector<double> operator[](const size_t i) const;
+        MyVector<double> operator()(const MyVector<double> &b) const
+            { return solve(b); }
 
         /*!
-         * @brief access operator, return reference to vector in at matrix index i
-         * @pre i must be in range of matrix A
+         * @brief const access operator, copy of row of factor L at index i
+         * @pre i must be in range of factor L
          * @param[in] i matrix index to access
-         * @throw std::out_of_range if i out of range of matrix A
-         * @post access matrix vector at index i
-         * @returns the reference to accessed matrix vector at index i
+         * @throw std::out_of_range if i out of range of factor L
+         * @post expands the stored profile of row i to a full length row
+         * @returns copy of the row of L at index i, zeros outside the profile
          */
-        MyVector<double>& operator[](const size_t i);
+        MyVector<double> operator[](const size_t i) const;
 
         /*!
          * @brief size function, returns size of member obj. matrix A 
@@ -120,6 +181,22 @@ class CholeskyDecomp
          */
         int size() const { return n; }
 
+        /*!
+         * @brief bandwidth function, returns half bandwidth of the factor
+         * @pre none
+         * @post gets the largest distance of a stored entry from the diagonal
+         * @returns the half bandwidth of the decomposed matrix
+         */
+        size_t bandwidth() const { return half_band; }
+
+        /*!
+         * @brief profile size function, returns amount of stored entries of L
+         * @pre none
+         * @post gets the amount of doubles stored for factor L
+         * @returns the amount of stored entries of factor L
+         */
+        size_t profile_size() const { return L.size(); }
+
         /*!
          * @brief swap function, swaps contents of a and b
          * @pre none
@@ -1,96 +1,215 @@
-CholeskyDecomp::CholeskyDecomp(const MyMatrix<double> &m)
+void CholeskyDecomp::factorize(const MyMatrix<double> &m)
 {
-    A.resize(m.rows(), m.cols());
-    decompose(m, A);
-    n = A.rows();
+    if(m.rows() != m.cols())
+        throw std::invalid_argument("cholesky given non-square matrix");
+
+    // the profile of row k starts at its first nonzero left of the diagonal
+    n = int(m.rows());
+    first_col = MyVector<size_t>(n);
+    for(int k = 0; k < n; k++)
+    {
+        const double *m_row = m.data() + k * m.stride();
+        size_t first = k;
+        for(int j = 0; j < k; j++)
+        {
+            if(m_row[j] != 0)
+            {
+                first = j;
+                break;
+            }
+        }
+        first_col[k] = first;
+    }
+    allocate_profile();
+
+    for(int k = 0; k < n; k++)
+    {
+        const double *m_row = m.data() + k * m.stride();
+        for(size_t j = first_col[k]; j <= size_t(k); j++)
+            L[row_start[k] + j - first_col[k]] = m_row[j];
+    }
+    decompose_profile();
 }
 
-CholeskyDecomp::CholeskyDecomp(const CholeskyDecomp &cd)
+void CholeskyDecomp::factorize(const MySparseMatrix<double> &m)
 {
-    A = cd.A;
-    n = cd.size();
+    if(m.rows() != m.cols())
+        throw std::invalid_argument("cholesky given non-square matrix");
+
+    // rows of m are sorted by column, so the first stored entry of each row
+    // is where its profile starts
+    n = int(m.rows());
+    first_col = MyVector<size_t>(n);
+    for(int k = 0; k < n; k++)
+    {
+        MySparseRow<const double> row = m[k];
+        first_col[k] = (row.size() > 0) ? std::min(row.col(0), size_t(k)) : k;
+    }
+    allocate_profile();
+
+    for(int k = 0; k < n; k++)
+    {
+        MySparseRow<const double> row = m[k];
+        for(size_t e = 0; e < row.size() && row.col(e) <= size_t(k); e++)
+            L[row_start[k] + row.col(e) - first_col[k]] = row.value(e);
+    }
+    decompose_profile();
 }
 
+CholeskyDecomp::CholeskyDecomp(const CholeskyDecomp &cd): L(cd.L),
+    row_start(cd.row_start), first_col(cd.first_col), n(cd.n),
+    half_band(cd.half_band) {}
+
 CholeskyDecomp& CholeskyDecomp::operator=(CholeskyDecomp &cd)
 {
     swap(cd, *this);
     return *this;
 }
 
-MyVector<double> CholeskyDecomp::operator()(MyVector<double> b)
+void CholeskyDecomp::allocate_profile()
+{
+    row_start = MyVector<size_t>(n + 1);
+    row_start[0] = 0;
+    half_band = 0;
+    for(int k = 0; k < n; k++)
+    {
+        row_start[k + 1] = row_start[k] + (k - first_col[k] + 1);
+        half_band = std::max(half_band, k - first_col[k]);
+    }
+
+    L = MyVector<double>(row_start[n]);
+    for(size_t e = 0; e < L.size(); e++)
+        L[e] = 0;
+}
+
+void CholeskyDecomp::decompose_profile()
+{
+    double *l = L.data();
+    for(int k = 0; k < n; k++)
+    {
+        size_t fk = first_col[k];
+        double *l_k = l + row_start[k] - fk; // l_k[j] is L[k][j], j >= fk
+
+        for(size_t i = fk; i < size_t(k); i++)
+        {
+            // entries of rows i and k left of either profile start are zero,
+            // so the dot product only runs over the overlap of both profiles
+            size_t fi = first_col[i];
+            const double *l_i = l + row_start[i] - fi;
+            double sum = 0;
+            for(size_t j = std::max(fi, fk); j < i; j++)
+                sum += l_i[j] * l_k[j];
+            l_k[i] = (l_k[i] - sum) / l_i[i];
+        }
+
+        double sum = 0;
+        for(size_t j = fk; j < size_t(k); j++)
+            sum += l_k[j] * l_k[j];
+        double diag = l_k[k] - sum;
+        if(diag <= 0)
+            throw std::invalid_argument("matrix in cholesky not positive definite");
+        l_k[k] = std::sqrt(diag);
+    }
+}
+
+MyVector<double> CholeskyDecomp::solve(MyVector<double> b) const
 {
     if(n != int(b.size()))
-        throw std::invalid_argument("A, b in cholesky() different sizes");
-    
-    // solve system [Ly = b] for y, where L = A, y new vector, b is param
-    MyVector<double> y(b.size());
+        throw std::invalid_argument("A, b in cholesky solve() different sizes");
+
+    // solve system [Ly = b] for y, y overwrites b in place
+    const double *l = L.data();
+    double *x = b.data();
     for(int i = 0; i < n; i++)
     {
+        const double *l_i = l + row_start[i] - first_col[i];
         double s = 0;
-        for(int j = 0; j < i; j++)
-            s += (A[i][j] * y[j]);
-        y[i] = (b[i] - s) / A[i][i];
+        for(size_t j = first_col[i]; j < size_t(i); j++)
+            s += l_i[j] * x[j];
+        x[i] = (x[i] - s) / l_i[i];
     }
 
-    // solve system [L(t)x = y], where L(t) is transpose of L, for x
-    MyMatrix<double> LT = A.transpose();
-    MyVector<double> x(b.size());
+    // solve system [L(t)x = y], where L(t) is transpose of L, for x; column
+    // i of L(t) is row i of L, so once x[i] is known its contribution is
+    // removed from the rows above it and no transpose is ever built
     for(int i = n - 1; i >= 0; i--)
     {
-        x[i] = y[i];
-        for(int j = i + 1; j < n; j++)
-            x[i] -= LT[i][j] * x[j];
-        x[i] /= LT[i][i];
+        const double *l_i = l + row_start[i] - first_col[i];
+        x[i] /= l_i[i];
+        for(size_t j = first_col[i]; j < size_t(i); j++)
+            x[j] -= l_i[j] * x[i];
     }
 
-    // readjust A matrix so calling object can be reused
-    A.transpose();
-
     // return completed x values after second back sub
-    return x;
+    return b;
 }
 
-void CholeskyDecomp::decompose(const MyMatrix<double> &a, MyMatrix<double> &l)
+MyMatrix<double> CholeskyDecomp::solve(MyMatrix<double> B) const
 {
-    for(int k = 0; k < int(l.rows()); k++)
+    if(size_t(n) != B.rows())
+        throw std::invalid_argument("A, B in cholesky solve() different sizes");
+
+    // same two sweeps as the vector solve, but each unknown is a whole row
+    // of B, so every entry of L is loaded once for all right hand sides
+    const double *l = L.data();
+    const size_t m = B.cols();
+    for(int i = 0; i < n; i++)
     {
-        for(int i = 0; i < k; i++)
+        const double *l_i = l + row_start[i] - first_col[i];
+        double *x_i = B.data() + i * B.stride();
+        for(size_t j = first_col[i]; j < size_t(i); j++)
         {
-            double sum = 0;
-            for(int j = 0; j < i; j++)
-                sum += l[i][j] * l[k][j];
-            l[k][i] = (a[k][i] - sum) / l[i][i];
+            const double *x_j = B.data() + j * B.stride();
+            for(size_t k = 0; k < m; k++)
+                x_i[k] -= l_i[j] * x_j[k];
         }
+        for(size_t k = 0; k < m; k++)
+            x_i[k] /= l_i[i];
+    }
 
-        double sum = 0;
-        for(int j = 0; j < k; j++)
-            sum += l[k][j] * l[k][j];
-        l[k][k] = std::sqrt(a[k][k] - sum);
+    for(int i = n - 1; i >= 0; i--)
+    {
+        const double *l_i = l + row_start[i] - first_col[i];
+        double *x_i = B.data() + i * B.stride();
+        for(size_t k = 0; k < m; k++)
+            x_i[k] /= l_i[i];
+        for(size_t j = first_col[i]; j < size_t(i); j++)
+        {
+            double *x_j = B.data() + j * B.stride();
+            for(size_t k = 0; k < m; k++)
+                x_j[k] -= l_i[j] * x_i[k];
+        }
     }
+    return B;
 }
 
 MyVector<double> CholeskyDecomp::operator[](const size_t i) const
 {
-    if(int(i) < 0 || i >= A.rows())
+    if(i >= size_t(n))
         throw std::out_of_range("i out of range for cholesky[]");
-    return A[i];
-}
 
-MyVector<double>& CholeskyDecomp::operator[](const size_t i)
-{
-    if(int(i) < 0 || i >= A.rows())
-        throw std::out_of_range("i out of range for cholesky[]");
-    return A[i];
+    MyVector<double> row(n);
+    for(size_t j = 0; j < size_t(n); j++)
+        row[j] = (j >= first_col[i] && j <= i) ? L[row_start[i] + j - first_col[i]] : 0;
+    return row;
 }
 
 void swap(CholeskyDecomp &a, CholeskyDecomp &b)
 {
-    swap(a.A, b.A);
+    swap(a.L, b.L);
+    swap(a.row_start, b.row_start);
+    swap(a.first_col, b.first_col);
     std::swap(a.n, b.n);
+    std::swap(a.half_band, b.half_band);
 }
 
 ostream& operator<<(ostream &out, const CholeskyDecomp &cd)
 {
-    out << cd.A;
+    for(int i = 0; i < cd.size(); i++)
+    {
+        out << cd[i];
+        if(i != cd.size() - 1)
+            out << std::endl;
+    }
     return out;
 }
\ No newline at end of file
@@ -0,0 +1,135 @@
+#ifndef CONJUGATE_GRADIENT_H
+#define CONJUGATE_GRADIENT_H
+
+#include "../containers/MyMatrix.h"
+#include "../containers/MySparseMatrix.h"
+#include "Preconditioner.h"
+#include "ConvergenceHistory.h"
+#include <chrono>
+#include <cmath>
+
+/*!
+ * @brief conjugate gradient class, a functor to wrap around the
+ *        (preconditioned) conjugate gradient method for spd systems
+ */
+template <typename Operator = MySparseMatrix<double>>
+class ConjugateGradient;
+
+/*!
+ * @brief swap function, swaps contents of a and b
+ * @pre none
+ * @param[in,out] a lhs of ConjugateGradient swap
+ * @param[in,out] b rhs of ConjugateGradient swap
+ * @post swaps the contents of ConjugateGradient objects a and b
+ */
+template <typename Operator>
+void swap(ConjugateGradient<Operator> &a, ConjugateGradient<Operator> &b);
+
+/*!
+ * @brief conjugate gradient class, a functor to wrap around the
+ *        (preconditioned) conjugate gradient method for spd systems;
+ *        Operator is the type of A, the assembled MySparseMatrix by default
+ *        or any type with the same rows() and row access, e.g. the
+ *        matrix-free PoissonStencil
+ */
+template <typename Operator>
+class ConjugateGradient
+{
+    private:
+        Operator A; //! operator A to solve equation Ax = b
+        int n; //! amount of rows/columns in matrix A
+        ConvergenceHistory history; //! residuals and timings of last solve
+
+    public:
+        /*!
+         * @brief default constructor, initialize empty A matrix of size 0
+         * @pre none
+         * @post creates a conjugategradient object with empty member vars.
+         */
+        ConjugateGradient(): A(), n(0), history() {}
+
+        /*!
+         * @brief param. constructor, given existing nxn matrix m
+         * @pre matrix m must be symmetric positive definite
+         * @param[in] m matrix to be used in conjugate gradient algorithm
+         * @throw std::invalid_argument if m is not square
+         * @post creates conjugategradient object to use on matrix A, storing
+         *       only the nonzero entries of m; requires Operator to be
+         *       constructible from a MyMatrix
+         */
+        explicit ConjugateGradient(const MyMatrix<double> &m);
+
+        /*!
+         * @brief param. constructor, given existing nxn operator m
+         * @pre operator m must be symmetric positive definite
+         * @param[in] m sparse matrix (or stencil) to be used in conjugate
+         *            gradient algorithm
+         * @throw std::invalid_argument if m is not square
+         * @post creates conjugategradient object to use on operator A
+         */
+        explicit ConjugateGradient(const Operator &m);
+
+        /*!
+         * @brief copy constructor, given existing conjugate gradient
+         * @pre none
+         * @param[in] cg existing conjugategradient object to copy
+         * @post creates conjugategradient object identical to cg
+         */
+        ConjugateGradient(const ConjugateGradient<Operator> &cg);
+
+        /*!
+         * @brief assignment operator, assigns calling object equal to cg
+         * @pre none
+         * @param[in] cg copy of conjugategradient object to swap with
+         * @post swaps contents of calling object and the copy cg
+         * @returns the modified calling object after assignment
+         */
+        ConjugateGradient<Operator>& operator=(ConjugateGradient<Operator> cg);
+
+        /*!
+         * @brief eval operator, solves Ax = b via preconditioned conjugate
+         *        gradient, starting from x = 0
+         * @pre tol must be positive, b must be same size as A
+         * @param[in] b rhs of linear system Ax = b
+         * @param[in] tol relative residual ||b - Ax|| / ||b|| to stop at
+         * @param[in] max_iter most iterations to run before giving up
+         * @param[in] m preconditioner applied to every residual, defaults to
+         *            none (plain conjugate gradient)
+         * @throw std::invalid_argument if tol not positive or b wrong size
+         * @post iterates until the relative residual is below tol or max_iter
+         *       iterations ran, recording every residual norm in history
+         * @returns solution vector x after the last iteration
+         */
+        MyVector<double> operator()(const MyVector<double> &b, const double tol,
+            const size_t max_iter, const Preconditioner &m = Preconditioner());
+
+        /*!
+         * @brief history function, returns the record of the last solve
+         * @pre none
+         * @post gets iteration count, residual norms and timings of last solve
+         * @returns the convergence history of the last solve
+         */
+        const ConvergenceHistory& get_history() const { return history; }
+
+        /*!
+         * @brief size function, returns size of member obj. matrix A
+         * @pre none
+         * @post gets the size of matrix A
+         * @returns the size of matrix A
+         */
+        int size() const { return n; }
+
+        /*!
+         * @brief swap function, swaps contents of a and b
+         * @pre none
+         * @param[in,out] a lhs of ConjugateGradient swap
+         * @param[in,out] b rhs of ConjugateGradient swap
+         * @post swaps the contents of ConjugateGradient objects a and b
+         */
+        friend void swap<Operator>(ConjugateGradient<Operator> &a,
+            ConjugateGradient<Operator> &b);
+};
+
+#include "ConjugateGradient.hpp"
+
+#endif
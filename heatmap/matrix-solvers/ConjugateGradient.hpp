@@ -0,0 +1,124 @@
+template <typename Operator>
+ConjugateGradient<Operator>::ConjugateGradient(const MyMatrix<double> &m)
+{
+    if(m.rows() != m.cols())
+        throw std::invalid_argument("conjugate gradient given non-square matrix");
+    A = Operator(m);
+    n = A.rows();
+}
+
+template <typename Operator>
+ConjugateGradient<Operator>::ConjugateGradient(const Operator &m)
+{
+    if(m.rows() != m.cols())
+        throw std::invalid_argument("conjugate gradient given non-square matrix");
+    A = m;
+    n = A.rows();
+}
+
+template <typename Operator>
+ConjugateGradient<Operator>::ConjugateGradient(const ConjugateGradient<Operator> &cg):
+    A(cg.A), n(cg.n), history(cg.history) {}
+
+template <typename Operator>
+ConjugateGradient<Operator>& ConjugateGradient<Operator>::operator=(
+    ConjugateGradient<Operator> cg)
+{
+    swap(*this, cg);
+    return *this;
+}
+
+template <typename Operator>
+MyVector<double> ConjugateGradient<Operator>::operator()(const MyVector<double> &b,
+    const double tol, const size_t max_iter, const Preconditioner &m)
+{
+    if(b.size() != A.rows())
+        throw std::invalid_argument("b not valid size for CG to solve Ax = b");
+    if(tol <= 0)
+        throw std::invalid_argument("invalid tolerance for conjugategradient()");
+
+    // x = 0, so the first residual is b itself
+    MyVector<double> x(b.size());
+    MyVector<double> r(b);
+    MyVector<double> z(b.size());
+    MyVector<double> p(b.size());
+    MyVector<double> q(b.size());
+    double *x_data = x.data();
+    double *r_data = r.data();
+    double *z_data = z.data();
+    double *p_data = p.data();
+    double *q_data = q.data();
+    for(int i = 0; i < n; i++)
+        x_data[i] = 0;
+
+    double b_norm = std::sqrt(b * b);
+    history.clear(b_norm);
+    if(b_norm == 0)
+    {
+        history.set_converged(true);
+        return x;
+    }
+
+    m.apply(r, z);
+    double rz = 0;
+    for(int i = 0; i < n; i++)
+    {
+        p_data[i] = z_data[i];
+        rz += r_data[i] * z_data[i];
+    }
+
+    for(size_t iter = 0; iter < max_iter; iter++)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        // q = Ap, step length alpha minimizes the A-norm error along p
+        double pq = 0;
+        for(int i = 0; i < n; i++)
+        {
+            q_data[i] = A[i].dot(p);
+            pq += p_data[i] * q_data[i];
+        }
+        double alpha = rz / pq;
+
+        double r_norm = 0;
+        for(int i = 0; i < n; i++)
+        {
+            x_data[i] += alpha * p_data[i];
+            r_data[i] -= alpha * q_data[i];
+            r_norm += r_data[i] * r_data[i];
+        }
+        r_norm = std::sqrt(r_norm);
+
+        bool done = r_norm <= tol * b_norm;
+        if(!done)
+        {
+            // next direction is the preconditioned residual made A-conjugate
+            // to every previous direction
+            m.apply(r, z);
+            double rz_new = 0;
+            for(int i = 0; i < n; i++)
+                rz_new += r_data[i] * z_data[i];
+            double beta = rz_new / rz;
+            rz = rz_new;
+            for(int i = 0; i < n; i++)
+                p_data[i] = z_data[i] + beta * p_data[i];
+        }
+
+        auto stop = std::chrono::steady_clock::now();
+        history.record(r_norm, std::chrono::duration<double>(stop - start).count());
+        if(done)
+        {
+            history.set_converged(true);
+            break;
+        }
+    }
+    return x;
+}
+
+template <typename Operator>
+void swap(ConjugateGradient<Operator> &a, ConjugateGradient<Operator> &b)
+{
+    swap(a.A, b.A);
+    std::swap(a.n, b.n);
+    std::swap(a.history, b.history);
+}
@@ -0,0 +1,137 @@
+#ifndef CONVERGENCE_HISTORY_H
+#define CONVERGENCE_HISTORY_H
+
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include <stdexcept>
+
+using std::ostream;
+
+/*!
+ * @brief convergence history class, record of an iterative solve: the
+ *        residual norm and time taken by every iteration
+ */
+class ConvergenceHistory;
+
+/*!
+ * @brief output operator, outputs history 'ch' to console
+ * @pre none
+ * @param[in,out] out ostream object to print contents
+ * @param[in] ch convergencehistory object to print to console
+ * @post prints one "iteration residual seconds" line per recorded iteration
+ * @returns the modified ostream object after printing
+ */
+ostream& operator<<(ostream &out, const ConvergenceHistory &ch);
+
+/*!
+ * @brief convergence history class, record of an iterative solve: the
+ *        residual norm and time taken by every iteration
+ */
+class ConvergenceHistory
+{
+    private:
+        std::vector<double> residuals; //! residual norm after each iteration
+        std::vector<double> seconds; //! time spent on each iteration
+        double initial; //! residual norm before the first iteration
+        bool is_converged; //! whether the solve met its tolerance
+
+    public:
+        /*!
+         * @brief default constructor, creates empty history
+         * @pre none
+         * @post creates convergencehistory with no recorded iterations
+         */
+        ConvergenceHistory(): residuals(), seconds(), initial(0),
+            is_converged(false) {}
+
+        /*!
+         * @brief clear function, empties the history for a new solve
+         * @pre none
+         * @param[in] initial_residual residual norm of the initial guess
+         * @post forgets every recorded iteration, marks not converged
+         */
+        void clear(const double initial_residual);
+
+        /*!
+         * @brief record function, appends one finished iteration
+         * @pre none
+         * @param[in] residual residual norm after the iteration
+         * @param[in] time seconds spent on the iteration
+         * @post appends residual and time to the history
+         */
+        void record(const double residual, const double time);
+
+        /*!
+         * @brief set converged function, marks whether the solve converged
+         * @pre none
+         * @param[in] converged true if the solve met its tolerance
+         * @post stores whether the solve converged
+         */
+        void set_converged(const bool converged) { is_converged = converged; }
+
+        /*!
+         * @brief converged function, returns whether the solve converged
+         * @pre none
+         * @post gets whether the solve met its tolerance
+         * @returns true if the solve met its tolerance
+         */
+        bool converged() const { return is_converged; }
+
+        /*!
+         * @brief iterations function, returns amount of recorded iterations
+         * @pre none
+         * @post gets the amount of iterations the solve took
+         * @returns the amount of recorded iterations
+         */
+        size_t iterations() const { return residuals.size(); }
+
+        /*!
+         * @brief residual function, returns residual norm after iteration k
+         * @pre k must be in range 0 <= k < iterations()
+         * @param[in] k index of the iteration
+         * @throw std::out_of_range if k >= iterations()
+         * @post gets the residual norm after iteration k
+         * @returns the residual norm after iteration k
+         */
+        double residual(const size_t k) const;
+
+        /*!
+         * @brief time function, returns seconds spent on iteration k
+         * @pre k must be in range 0 <= k < iterations()
+         * @param[in] k index of the iteration
+         * @throw std::out_of_range if k >= iterations()
+         * @post gets the time spent on iteration k
+         * @returns the seconds spent on iteration k
+         */
+        double time(const size_t k) const;
+
+        /*!
+         * @brief initial residual function, returns residual of initial guess
+         * @pre none
+         * @post gets the residual norm before the first iteration
+         * @returns the residual norm before the first iteration
+         */
+        double initial_residual() const { return initial; }
+
+        /*!
+         * @brief final residual function, returns the last residual norm
+         * @pre none
+         * @post gets residual after last iteration, initial if none recorded
+         * @returns the residual norm the solve finished with
+         */
+        double final_residual() const
+            { return residuals.empty() ? initial : residuals.back(); }
+
+        /*!
+         * @brief total time function, returns seconds spent on all iterations
+         * @pre none
+         * @post adds up the time of every recorded iteration
+         * @returns the seconds spent on all iterations
+         */
+        double total_time() const;
+};
+
+#include "ConvergenceHistory.hpp"
+
+#endif
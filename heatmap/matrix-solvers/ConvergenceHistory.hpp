@@ -0,0 +1,46 @@
+void ConvergenceHistory::clear(const double initial_residual)
+{
+    residuals.clear();
+    seconds.clear();
+    initial = initial_residual;
+    is_converged = false;
+}
+
+void ConvergenceHistory::record(const double residual, const double time)
+{
+    residuals.push_back(residual);
+    seconds.push_back(time);
+}
+
+double ConvergenceHistory::residual(const size_t k) const
+{
+    if(k >= residuals.size())
+        throw std::out_of_range("k out of range for convergence history residual");
+    return residuals[k];
+}
+
+double ConvergenceHistory::time(const size_t k) const
+{
+    if(k >= seconds.size())
+        throw std::out_of_range("k out of range for convergence history time");
+    return seconds[k];
+}
+
+double ConvergenceHistory::total_time() const
+{
+    double total = 0;
+    for(size_t k = 0; k < seconds.size(); k++)
+        total += seconds[k];
+    return total;
+}
+
+ostream& operator<<(ostream &out, const ConvergenceHistory &ch)
+{
+    for(size_t k = 0; k < ch.iterations(); k++)
+    {
+        out << k + 1 << " " << ch.residual(k) << " " << ch.time(k);
+        if(k != ch.iterations() - 1)
+            out << std::endl;
+    }
+    return out;
+}
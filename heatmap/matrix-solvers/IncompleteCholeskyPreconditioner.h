@@ -0,0 +1,51 @@
+#ifndef INCOMPLETE_CHOLESKY_PRECONDITIONER_H
+#define INCOMPLETE_CHOLESKY_PRECONDITIONER_H
+
+#include "Preconditioner.h"
+#include "../containers/MySparseMatrix.h"
+#include <cmath>
+
+/*! incomplete cholesky preconditioner class, zero fill-in cholesky of A
+ * @brief incomplete cholesky preconditioner class, IC(0): a cholesky factor
+ *        L restricted to the nonzero pattern of the lower triangle of A, so
+ *        M = LL(t) costs no more storage than A itself
+ */
+class IncompleteCholeskyPreconditioner : public Preconditioner
+{
+    private:
+        MySparseMatrix<double> L; //! incomplete factor, lower triangle of A
+
+    public:
+        /*!
+         * @brief param. constructor, given existing nxn operator a
+         * @pre a must be symmetric positive definite, the factorization is
+         *      guaranteed to exist for M-matrices such as the poisson system
+         * @param[in] a sparse matrix (or stencil) to be preconditioned
+         * @throw std::invalid_argument if a is not square or a pivot of the
+         *        incomplete factorization is not positive
+         * @post factors a, dropping every entry outside the pattern of a
+         */
+        template <typename Operator>
+        explicit IncompleteCholeskyPreconditioner(const Operator &a);
+
+        /*!
+         * @brief apply function, solves LL(t)z = r for z
+         * @pre r and z must have the same size as the preconditioned matrix
+         * @param[in] r residual vector to precondition
+         * @param[out] z preconditioned residual, (LL(t))^-1 r
+         * @post performs forward and back substitution with L in O(nnz)
+         */
+        void apply(const MyVector<double> &r, MyVector<double> &z) const;
+
+        /*!
+         * @brief name function, returns name of the preconditioner
+         * @pre none
+         * @post gets a short name describing the preconditioner
+         * @returns the name of the preconditioner
+         */
+        const char* name() const { return "incomplete cholesky"; }
+};
+
+#include "IncompleteCholeskyPreconditioner.hpp"
+
+#endif
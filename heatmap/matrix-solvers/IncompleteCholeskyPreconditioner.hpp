@@ -0,0 +1,81 @@
+template <typename Operator>
+IncompleteCholeskyPreconditioner::IncompleteCholeskyPreconditioner(
+    const Operator &a)
+{
+    if(a.rows() != a.cols())
+        throw std::invalid_argument("incomplete cholesky given non-square matrix");
+
+    // copy the lower triangle of a, the factor keeps exactly its pattern
+    size_t n = a.rows();
+    L = MySparseMatrix<double>(n, n, 3);
+    for(size_t i = 0; i < n; i++)
+    {
+        typename Operator::const_row_type row = a[i];
+        for(size_t k = 0; k < row.size() && row.col(k) <= i; k++)
+            L.insert(row.col(k), row.value(k));
+        L.end_row();
+    }
+
+    // row by row cholesky, each dot product only runs over columns stored
+    // in both rows, found by merging the two sorted column lists
+    for(size_t i = 0; i < n; i++)
+    {
+        MySparseRow<double> l_i = L[i];
+        if(l_i.size() == 0 || l_i.col(l_i.size() - 1) != i)
+            throw std::invalid_argument("incomplete cholesky given zero diagonal");
+
+        for(size_t e = 0; e + 1 < l_i.size(); e++)
+        {
+            size_t j = l_i.col(e);
+            MySparseRow<const double> l_j = L[j];
+            double sum = 0;
+            size_t p = 0;
+            size_t q = 0;
+            while(p < e && q + 1 < l_j.size())
+            {
+                if(l_i.col(p) == l_j.col(q))
+                    sum += l_i.value(p++) * l_j.value(q++);
+                else if(l_i.col(p) < l_j.col(q))
+                    p++;
+                else
+                    q++;
+            }
+            l_i.value(e) = (l_i.value(e) - sum) / l_j.value(l_j.size() - 1);
+        }
+
+        double sum = 0;
+        for(size_t e = 0; e + 1 < l_i.size(); e++)
+            sum += l_i.value(e) * l_i.value(e);
+        double diag = l_i.value(l_i.size() - 1) - sum;
+        if(diag <= 0)
+            throw std::invalid_argument("incomplete cholesky pivot not positive");
+        l_i.value(l_i.size() - 1) = std::sqrt(diag);
+    }
+}
+
+void IncompleteCholeskyPreconditioner::apply(const MyVector<double> &r,
+    MyVector<double> &z) const
+{
+    // forward sweep [Ly = r], y written to z; the diagonal is the last
+    // stored entry of every row of L
+    const double *r_data = r.data();
+    double *z_data = z.data();
+    size_t n = L.rows();
+    for(size_t i = 0; i < n; i++)
+    {
+        MySparseRow<const double> l_i = L[i];
+        double s = 0;
+        for(size_t e = 0; e + 1 < l_i.size(); e++)
+            s += l_i.value(e) * z_data[l_i.col(e)];
+        z_data[i] = (r_data[i] - s) / l_i.value(l_i.size() - 1);
+    }
+
+    // backward sweep [L(t)z = y], column i of L(t) is row i of L
+    for(size_t i = n; i-- > 0; )
+    {
+        MySparseRow<const double> l_i = L[i];
+        z_data[i] /= l_i.value(l_i.size() - 1);
+        for(size_t e = 0; e + 1 < l_i.size(); e++)
+            z_data[l_i.col(e)] -= l_i.value(e) * z_data[i];
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef JACOBI_PRECONDITIONER_H
+#define JACOBI_PRECONDITIONER_H
+
+#include "Preconditioner.h"
+#include "../containers/MySparseMatrix.h"
+
+/*! jacobi preconditioner class, preconditions with the diagonal of A
+ * @brief jacobi preconditioner class, M is the diagonal of A, so applying
+ *        M^-1 scales each residual element by the inverse diagonal
+ */
+class JacobiPreconditioner : public Preconditioner
+{
+    private:
+        MyVector<double> inv_diag; //! inverse of each diagonal entry of A
+
+    public:
+        /*!
+         * @brief param. constructor, given existing nxn operator a
+         * @pre a must be square with a nonzero diagonal
+         * @param[in] a sparse matrix (or stencil) to be preconditioned
+         * @throw std::invalid_argument if a is not square or a diagonal entry
+         *        is zero
+         * @post stores the inverse of every diagonal entry of a
+         */
+        template <typename Operator>
+        explicit JacobiPreconditioner(const Operator &a);
+
+        /*!
+         * @brief apply function, solves Mz = r for z
+         * @pre r and z must have the same size as the preconditioned matrix
+         * @param[in] r residual vector to precondition
+         * @param[out] z preconditioned residual, r scaled by inverse diagonal
+         * @post writes M^-1 r to z in O(n)
+         */
+        void apply(const MyVector<double> &r, MyVector<double> &z) const;
+
+        /*!
+         * @brief name function, returns name of the preconditioner
+         * @pre none
+         * @post gets a short name describing the preconditioner
+         * @returns the name of the preconditioner
+         */
+        const char* name() const { return "jacobi"; }
+};
+
+#include "JacobiPreconditioner.hpp"
+
+#endif
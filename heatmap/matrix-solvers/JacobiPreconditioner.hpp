@@ -0,0 +1,24 @@
+template <typename Operator>
+JacobiPreconditioner::JacobiPreconditioner(const Operator &a)
+{
+    if(a.rows() != a.cols())
+        throw std::invalid_argument("jacobi preconditioner given non-square matrix");
+
+    inv_diag = MyVector<double>(a.rows());
+    for(size_t i = 0; i < a.rows(); i++)
+    {
+        double diag = a(i, i);
+        if(diag == 0)
+            throw std::invalid_argument("jacobi preconditioner given zero diagonal");
+        inv_diag[i] = 1 / diag;
+    }
+}
+
+void JacobiPreconditioner::apply(const MyVector<double> &r, MyVector<double> &z) const
+{
+    const double *r_data = r.data();
+    const double *d_data = inv_diag.data();
+    double *z_data = z.data();
+    for(size_t i = 0; i < r.size(); i++)
+        z_data[i] = r_data[i] * d_data[i];
+}
@@ -0,0 +1,250 @@
+#ifndef POISSON_BATCH_H
+#define POISSON_BATCH_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include "../containers/MyVector.h"
+#include "../containers/MyBitMask.h"
+#include "../../common/MyThreadPool.h"
+#include "../inputters/ManifestInputter.h"
+#include "../outputters/CSVOutputter.h"
+#include "PoissonMatrixMaker.h"
+#include "PoissonStencil.h"
+#include "CholeskyDecomp.h"
+#include "SuccessiveOR.h"
+#include "ConjugateGradient.h"
+#include "IncompleteCholeskyPreconditioner.h"
+#include "PoissonMultigrid.h"
+
+/*! tolerance of the sor methods (S, A and R) when a job gives none */
+const double SOR_DEFAULT_TOLERANCE = 0.01;
+
+/*! relative residual conjugate gradient and multigrid (G and M) stop at
+ *  when a job gives none
+ */
+const double RESIDUAL_DEFAULT_TOLERANCE = 1e-8;
+
+/*! most full multigrid cycles a multigrid job runs */
+const size_t MULTIGRID_MAX_CYCLES = 100;
+
+/*!
+ * @brief method name function, returns the name of a method for printing
+ * @pre none
+ * @param[in] method letter of a method, one of POISSON_METHODS
+ * @throw std::invalid_argument if method is not one of POISSON_METHODS
+ * @post none
+ * @returns name of the method, such as "Successive OR" for S
+ */
+string poisson_method_name(const char method);
+
+/*!
+ * @brief default tolerance function, returns the tolerance of a method
+ * @pre none
+ * @param[in] method letter of a method, one of POISSON_METHODS
+ * @throw std::invalid_argument if method is not one of POISSON_METHODS
+ * @post none
+ * @returns the tolerance a job of method runs with if it gives none, 0 for
+ *          cholesky, which solves directly
+ */
+double default_tolerance(const char method);
+
+/*! poisson input struct, everything read and built from one grid file
+ * @brief poisson input struct, the mask of a grid, its stencil and the
+ *        right hand side of its system; read-only once built, so jobs on
+ *        the same grid share one
+ */
+struct PoissonInput
+{
+    MyBitMask mask; //! the pixels, a set bit for every unknown
+    PoissonStencil stencil; //! matrix-free poisson operator of mask
+    MyVector<double> b; //! right hand side, the forcing function
+
+    /*!
+     * @brief param. constructor, reads the grid in path
+     * @pre none
+     * @param[in] path b/w text grid or pgm/ppm image
+     * @throw std::invalid_argument if path cannot be read
+     * @post reads the mask and builds its stencil and right hand side
+     */
+    explicit PoissonInput(const string &path): mask(read_bw_mask(path)),
+        stencil(mask), b(calc_poisson_vector(stencil.rows(), forcing_func())) {}
+};
+
+/*!
+ * @brief poisson cache class, the inputs and factorizations of a batch
+ *        shared between the jobs that need them
+ */
+class PoissonCache
+{
+    private:
+        /*! a cached object, ready once the job building it finished */
+        template <typename T>
+        using Slot = std::shared_future<std::shared_ptr<const T>>;
+
+        /*! cache entry struct, everything cached for one grid file
+         * @brief cache entry struct, the objects built from one grid file
+         *        and the amount of jobs still to use them
+         */
+        struct Entry
+        {
+            Slot<PoissonInput> input; //! mask, stencil and right hand side
+            Slot<CholeskyDecomp> cholesky; //! cholesky factor of A
+            Slot<IncompleteCholeskyPreconditioner> preconditioner; //! IC(0)
+            Slot<PoissonMultigrid> multigrid; //! grid hierarchy of the mask
+            size_t uses; //! jobs on the grid that have not released it
+
+            Entry(): input(), cholesky(), preconditioner(), multigrid(),
+                uses(0) {}
+        };
+
+        std::mutex lock; //! guards entries
+        std::map<string, Entry> entries; //! entry of every grid file in use
+
+        /*!
+         * @brief fetch function, returns a cached object, building it once
+         * @pre none
+         * @param[in] path grid file the object belongs to
+         * @param[in] slot slot of the entry the object is cached in
+         * @param[in] make function building the object, called as make()
+         * @throw whatever make threw, to every caller waiting on the object
+         * @post the first caller builds the object outside the lock, later
+         *       callers wait for it instead of building it again
+         * @returns the cached object
+         */
+        template <typename T, typename F>
+        std::shared_ptr<const T> fetch(const string &path,
+            Slot<T> Entry::*slot, const F &make);
+
+    public:
+        /*!
+         * @brief default constructor, creates an empty cache
+         * @pre none
+         * @post creates poissoncache object whose entries live until release
+         */
+        PoissonCache(): lock(), entries() {}
+
+        /*!
+         * @brief param. constructor, creates an empty cache for jobs
+         * @pre none
+         * @param[in] jobs every job that will use the cache
+         * @post counts the jobs on every grid file, so release frees an
+         *       entry once the last of them is done
+         */
+        explicit PoissonCache(const MyVector<PoissonJob> &jobs);
+
+        /*! copy constructor, deleted as the cache owns a mutex */
+        PoissonCache(const PoissonCache &pc) = delete;
+
+        /*! assignment operator, deleted as the cache owns a mutex */
+        PoissonCache& operator=(const PoissonCache &pc) = delete;
+
+        /*!
+         * @brief input function, returns the input read from path
+         * @pre none
+         * @param[in] path b/w text grid or pgm/ppm image
+         * @throw std::invalid_argument if path cannot be read
+         * @post reads path on the first call
+         * @returns mask, stencil and right hand side of path
+         */
+        std::shared_ptr<const PoissonInput> input(const string &path);
+
+        /*!
+         * @brief cholesky function, returns the cholesky factor of path
+         * @pre none
+         * @param[in] path b/w text grid or pgm/ppm image
+         * @throw std::invalid_argument if path cannot be read
+         * @post assembles and factors the matrix of path on the first call
+         * @returns the factor, its solve() is safe to call concurrently
+         */
+        std::shared_ptr<const CholeskyDecomp> cholesky(const string &path);
+
+        /*!
+         * @brief preconditioner function, returns the IC(0) factor of path
+         * @pre none
+         * @param[in] path b/w text grid or pgm/ppm image
+         * @throw std::invalid_argument if path cannot be read
+         * @post factors the stencil of path on the first call
+         * @returns the preconditioner, its apply() is safe to call
+         *          concurrently
+         */
+        std::shared_ptr<const IncompleteCholeskyPreconditioner>
+            preconditioner(const string &path);
+
+        /*!
+         * @brief multigrid function, returns the grid hierarchy of path
+         * @pre none
+         * @param[in] path b/w text grid or pgm/ppm image
+         * @throw std::invalid_argument if path cannot be read or has no
+         *        unknowns
+         * @post builds the hierarchy, and factors its coarsest level, on the
+         *       first call
+         * @returns the hierarchy; full_multigrid changes the levels it
+         *          solves with, so every job solves with its own copy
+         */
+        std::shared_ptr<const PoissonMultigrid> multigrid(const string &path);
+
+        /*!
+         * @brief release function, marks one job on path as done
+         * @pre none
+         * @param[in] path grid file of the job
+         * @post frees the entry of path after the last job counted for it;
+         *       objects still held by a job stay alive until it drops them
+         */
+        void release(const string &path);
+
+        /*!
+         * @brief size function, returns the amount of cached grid files
+         * @pre none
+         * @post none
+         * @returns the amount of grid files with an entry
+         */
+        size_t size();
+};
+
+/*!
+ * @brief solve function, solves the poisson system of one job
+ * @pre input must be the input of job.input
+ * @param[in] job the job to solve, job.output is not written
+ * @param[in] input mask, stencil and right hand side of the job's grid
+ * @param[in,out] cache cache to take factorizations of the grid from
+ * @param[in] threads threads red-black sor may use
+ * @param[out] stats sweeps, iterations or cycles the method took, for
+ *             printing
+ * @throw std::invalid_argument if job.method is unknown or the method
+ *        rejects the system
+ * @post solves with the method and tolerance of the job, the default
+ *       tolerance of the method if the job gives none
+ * @returns solution vector, one value per unknown
+ */
+MyVector<double> solve_poisson(const PoissonJob &job,
+    const PoissonInput &input, PoissonCache &cache, const size_t threads,
+    string &stats);
+
+/*!
+ * @brief batch run function, runs every job of a manifest
+ * @pre no container operation may be running
+ * @param[in] jobs the jobs to run
+ * @param[in] workers jobs to run at once, 0 for one per core
+ * @param[in,out] log stream to report every job on
+ * @post runs the jobs on a pool of workers threads, jobs on the same grid
+ *       one after another so they share its input and factorizations; each
+ *       job runs its container operations on its own thread, and a failing
+ *       job is reported without stopping the others
+ * @returns the amount of jobs that failed
+ */
+size_t run_poisson_batch(const MyVector<PoissonJob> &jobs, size_t workers,
+    std::ostream &log);
+
+#include "PoissonBatch.hpp"
+
+#endif
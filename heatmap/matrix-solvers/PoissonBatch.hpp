@@ -0,0 +1,252 @@
+string poisson_method_name(const char method)
+{
+    switch(method)
+    {
+        case 'C': return "Cholesky Decomp";
+        case 'S': return "Successive OR";
+        case 'A': return "Adaptive Successive OR";
+        case 'R': return "Red-Black Successive OR";
+        case 'G': return "Conjugate Gradient";
+        case 'M': return "Full Multigrid";
+    }
+    throw std::invalid_argument(string("unknown method ") + method);
+}
+
+double default_tolerance(const char method)
+{
+    if(method == 'C')
+        return 0;
+    if(method == 'S' || method == 'A' || method == 'R')
+        return SOR_DEFAULT_TOLERANCE;
+    if(method == 'G' || method == 'M')
+        return RESIDUAL_DEFAULT_TOLERANCE;
+    throw std::invalid_argument(string("unknown method ") + method);
+}
+
+PoissonCache::PoissonCache(const MyVector<PoissonJob> &jobs): lock(),
+    entries()
+{
+    for(size_t k = 0; k < jobs.size(); k++)
+        entries[jobs[k].input].uses++;
+}
+
+template <typename T, typename F>
+std::shared_ptr<const T> PoissonCache::fetch(const string &path,
+    Slot<T> Entry::*slot, const F &make)
+{
+    std::promise<std::shared_ptr<const T>> promise;
+    Slot<T> ready;
+    bool owner = false;
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        Slot<T> &cached = entries[path].*slot;
+        if(!cached.valid())
+        {
+            cached = promise.get_future().share();
+            owner = true;
+        }
+        ready = cached;
+    }
+
+    // built outside the lock, jobs on other grids keep going meanwhile
+    if(owner)
+    {
+        try
+        {
+            promise.set_value(make());
+        }
+        catch(...)
+        {
+            promise.set_exception(std::current_exception());
+        }
+    }
+    return ready.get();
+}
+
+std::shared_ptr<const PoissonInput> PoissonCache::input(const string &path)
+{
+    return fetch(path, &Entry::input, [&path]()
+        { return std::make_shared<const PoissonInput>(path); });
+}
+
+std::shared_ptr<const CholeskyDecomp> PoissonCache::cholesky(
+    const string &path)
+{
+    return fetch(path, &Entry::cholesky, [this, &path]()
+        {
+            std::shared_ptr<const PoissonInput> in = input(path);
+            return std::make_shared<const CholeskyDecomp>(
+                assemble_poisson_matrix(in->stencil.get_index_map()));
+        });
+}
+
+std::shared_ptr<const IncompleteCholeskyPreconditioner>
+    PoissonCache::preconditioner(const string &path)
+{
+    return fetch(path, &Entry::preconditioner, [this, &path]()
+        {
+            std::shared_ptr<const PoissonInput> in = input(path);
+            return std::make_shared<const IncompleteCholeskyPreconditioner>(
+                in->stencil);
+        });
+}
+
+std::shared_ptr<const PoissonMultigrid> PoissonCache::multigrid(
+    const string &path)
+{
+    return fetch(path, &Entry::multigrid, [this, &path]()
+        {
+            std::shared_ptr<const PoissonInput> in = input(path);
+            return std::make_shared<const PoissonMultigrid>(in->mask);
+        });
+}
+
+void PoissonCache::release(const string &path)
+{
+    std::lock_guard<std::mutex> guard(lock);
+    std::map<string, Entry>::iterator it = entries.find(path);
+    if(it != entries.end() && it->second.uses <= 1)
+        entries.erase(it);
+    else if(it != entries.end())
+        it->second.uses--;
+}
+
+size_t PoissonCache::size()
+{
+    std::lock_guard<std::mutex> guard(lock);
+    return entries.size();
+}
+
+MyVector<double> solve_poisson(const PoissonJob &job,
+    const PoissonInput &input, PoissonCache &cache, const size_t threads,
+    string &stats)
+{
+    const double tol = (job.tolerance > 0) ? job.tolerance :
+        default_tolerance(job.method);
+    std::ostringstream out;
+    MyVector<double> x;
+
+    if(job.method == 'C')
+        x = cache.cholesky(job.input)->solve(input.b);
+    else if(job.method == 'S')
+    {
+        SuccessiveOR<PoissonStencil> successive_or(input.stencil);
+        x = successive_or(input.b, get_w_value(), tol, SOR_MAX_ITERATIONS);
+        out << "Sweeps: " << successive_or.get_history().iterations();
+    }
+    else if(job.method == 'A')
+    {
+        SuccessiveOR<PoissonStencil> successive_or(input.stencil);
+        x = successive_or.solve_adaptive(input.b, tol, SOR_MAX_ITERATIONS);
+        out << "Sweeps: " << successive_or.get_history().iterations()
+            << ", Omega: " << successive_or.get_omega();
+    }
+    else if(job.method == 'R')
+    {
+        SuccessiveOR<PoissonStencil> successive_or(input.stencil);
+        x = successive_or.solve_red_black(input.b, get_w_value(), tol, threads,
+            SOR_MAX_ITERATIONS);
+        out << "Sweeps: " << successive_or.get_history().iterations()
+            << ", Threads: " << threads;
+    }
+    else if(job.method == 'G')
+    {
+        ConjugateGradient<PoissonStencil> conjugate_gradient(input.stencil);
+        x = conjugate_gradient(input.b, tol, input.stencil.rows(),
+            *cache.preconditioner(job.input));
+        out << "Iterations: " << conjugate_gradient.get_history().iterations();
+    }
+    else if(job.method == 'M')
+    {
+        PoissonMultigrid multigrid(*cache.multigrid(job.input));
+        x = multigrid.full_multigrid(input.b, tol, MULTIGRID_MAX_CYCLES);
+        out << "Levels: " << multigrid.levels() << ", Cycles: "
+            << multigrid.get_history().iterations();
+    }
+    else
+        throw std::invalid_argument(string("unknown method ") + job.method);
+
+    stats = out.str();
+    return x;
+}
+
+size_t run_poisson_batch(const MyVector<PoissonJob> &jobs, size_t workers,
+    std::ostream &log)
+{
+    const size_t cores = std::max(std::thread::hardware_concurrency(), 1u);
+    if(workers == 0)
+        workers = cores;
+    workers = std::max(std::min(workers, jobs.size()), size_t(1));
+
+    // jobs on one grid run back to back, so its entry is freed soon after
+    // it is first built and the cache holds about one grid per worker
+    MyVector<size_t> order(jobs.size());
+    for(size_t k = 0; k < order.size(); k++)
+        order[k] = k;
+    std::stable_sort(order.data(), order.data() + order.size(),
+        [&jobs](const size_t a, const size_t b)
+            { return jobs[a].input < jobs[b].input; });
+
+    PoissonCache cache(jobs);
+    std::mutex log_lock;
+    std::atomic<size_t> next(0);
+    std::atomic<size_t> failed(0);
+    const size_t threads = std::max(cores / workers, size_t(1));
+
+    // every worker takes the next job in order until none are left
+    auto work = [&](const size_t, const size_t)
+    {
+        for(size_t n = next++; n < order.size(); n = next++)
+        {
+            const PoissonJob &job = jobs[order[n]];
+            const string name = "job " + std::to_string(order[n] + 1) + "/" +
+                std::to_string(jobs.size()) + " (line " +
+                std::to_string(job.line) + ")";
+            try
+            {
+                auto start = std::chrono::high_resolution_clock::now();
+                std::shared_ptr<const PoissonInput> input =
+                    cache.input(job.input);
+                string stats;
+                MyVector<double> x = solve_poisson(job, *input, cache, threads,
+                    stats);
+                CSVOutputter csv_outputter(input->mask, x);
+                csv_outputter();
+                csv_outputter.output_to_path(job.output);
+                auto stop = std::chrono::high_resolution_clock::now();
+                auto dur = std::chrono::duration_cast<
+                    std::chrono::milliseconds>(stop - start);
+
+                std::lock_guard<std::mutex> guard(log_lock);
+                log << name << ": " << poisson_method_name(job.method)
+                    << " on " << job.input << " -> " << job.output << ", "
+                    << (stats.empty() ? string() : stats + ", ")
+                    << "Time (ms): " << dur.count() << std::endl;
+            }
+            catch(const std::exception &e)
+            {
+                failed++;
+                std::lock_guard<std::mutex> guard(log_lock);
+                log << name << " failed: " << e.what() << std::endl;
+            }
+            cache.release(job.input);
+        }
+    };
+
+    if(workers == 1)
+    {
+        work(0, 0);
+        return failed;
+    }
+
+    // the jobs themselves fill the cores, so their container operations
+    // run serially rather than all sharing one pool
+    const size_t saved_threads = container_threads();
+    set_container_threads(1);
+    {
+        MyThreadPool pool(workers - 1);
+        pool.parallel_for(0, workers, 1, work);
+    }
+    set_container_threads(saved_threads);
+    return failed;
+}
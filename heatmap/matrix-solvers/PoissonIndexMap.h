@@ -0,0 +1,152 @@
+#ifndef POISSON_INDEX_MAP_H
+#define POISSON_INDEX_MAP_H
+
+#include "../containers/MyVector.h"
+#include "../containers/MyBitMask.h"
+#include <string>
+using std::string;
+
+/*!
+ * @brief poisson index map class, maps each pixel of a b/w grid to its
+ *        unknown number in the poisson system and each unknown back to its
+ *        pixel; unknowns are numbered from the bottom row up, left to right
+ */
+class PoissonIndexMap;
+
+/*!
+ * @brief swap function, swaps contents of a and b
+ * @pre none
+ * @param[in,out] a lhs of PoissonIndexMap swap
+ * @param[in,out] b rhs of PoissonIndexMap swap
+ * @post swaps the contents of PoissonIndexMap objects a and b
+ */
+void swap(PoissonIndexMap &a, PoissonIndexMap &b);
+
+/*!
+ * @brief poisson index map class, maps each pixel of a b/w grid to its
+ *        unknown number in the poisson system and each unknown back to its
+ *        pixel; unknowns are numbered from the bottom row up, left to right
+ */
+class PoissonIndexMap
+{
+    private:
+        MyVector<int> pixel_unknown; //! unknown at pixel (i*c + j), -1 if 'W'
+        MyVector<size_t> unknown_pixel; //! pixel (i*c + j) of each unknown
+        size_t r; //! number of rows in the b/w grid
+        size_t c; //! number of cols in the b/w grid (longest line)
+        size_t n; //! number of unknowns ('B' pixels) in the b/w grid
+
+    public:
+        /*!
+         * @brief default constructor, create empty map of a 0x0 grid
+         * @pre none
+         * @post creates poissonindexmap object with no pixels or unknowns
+         */
+        PoissonIndexMap(): pixel_unknown(), unknown_pixel(), r(0), c(0), n(0) {}
+
+        /*!
+         * @brief param. constructor, numbers the unknowns of b/w grid bwm_sep
+         * @pre none
+         * @param[in] bwm_sep vector of strings, one per line of the b/w grid
+         * @post packs bwm_sep into a mask and numbers its 'B' pixels from the
+         *       bottom row up, left to right; lines shorter than the longest
+         *       line are treated as padded with 'W'
+         */
+        explicit PoissonIndexMap(const MyVector<string> &bwm_sep);
+
+        /*!
+         * @brief param. constructor, numbers the unknowns of b/w mask mask
+         * @pre none
+         * @param[in] mask b/w grid, a set bit for every 'B' pixel
+         * @post numbers every set pixel of mask from the bottom row up, left
+         *       to right, visiting only the set bits of each word
+         */
+        explicit PoissonIndexMap(const MyBitMask &mask);
+
+        /*!
+         * @brief copy constructor, given existing poissonindexmap object
+         * @pre none
+         * @param[in] pim existing poissonindexmap object to copy
+         * @post creates poissonindexmap object identical to pim
+         */
+        PoissonIndexMap(const PoissonIndexMap &pim);
+
+        /*!
+         * @brief assignment operator, assigns calling object equal to pim
+         * @pre none
+         * @param[in] pim copy of poissonindexmap object to swap with
+         * @post swaps contents of calling object and the copy pim
+         * @returns the modified calling object after swap
+         */
+        PoissonIndexMap& operator=(PoissonIndexMap pim);
+
+        /*!
+         * @brief eval operator, returns unknown number of pixel (i, j)
+         * @pre none
+         * @param[in] i row of the pixel (0 is the top line of the file)
+         * @param[in] j col of the pixel
+         * @post looks up the unknown at pixel (i, j) in constant time
+         * @returns unknown number of pixel (i, j), or -1 if the pixel is not
+         *          an unknown or lies outside the grid
+         */
+        int operator()(const int i, const int j) const;
+
+        /*!
+         * @brief pixel function, returns pixel location of unknown k
+         * @pre k must be in range 0 <= k < size()
+         * @param[in] k unknown number to locate
+         * @param[out] i row of the pixel of unknown k
+         * @param[out] j col of the pixel of unknown k
+         * @throw std::out_of_range if k >= size()
+         * @post finds the pixel of unknown k in constant time
+         */
+        void pixel(const size_t k, int &i, int &j) const;
+
+        /*!
+         * @brief row pointer function, returns unknowns of the pixels of row i
+         * @pre i must be in range 0 <= i < rows()
+         * @param[in] i row of the b/w grid
+         * @post returns pointer to cols() unknown numbers, -1 for pixels that
+         *       are not unknowns; never checks i
+         * @returns pointer to the unknown number of pixel (i, 0)
+         */
+        const int* row_ptr(const size_t i) const
+            { return pixel_unknown.data() + i * c; }
+
+        /*!
+         * @brief rows function, returns number of rows in the b/w grid
+         * @pre none
+         * @post gets the number of rows in the b/w grid
+         * @returns the number of rows in the b/w grid
+         */
+        size_t rows() const { return r; }
+
+        /*!
+         * @brief cols function, returns number of cols in the b/w grid
+         * @pre none
+         * @post gets the number of cols in the b/w grid
+         * @returns the number of cols in the b/w grid
+         */
+        size_t cols() const { return c; }
+
+        /*!
+         * @brief size function, returns number of unknowns in the b/w grid
+         * @pre none
+         * @post gets the number of unknowns ('B' pixels) in the b/w grid
+         * @returns the number of unknowns in the b/w grid
+         */
+        size_t size() const { return n; }
+
+        /*!
+         * @brief swap function, swaps contents of a and b
+         * @pre none
+         * @param[in,out] a lhs of PoissonIndexMap swap
+         * @param[in,out] b rhs of PoissonIndexMap swap
+         * @post swaps the contents of PoissonIndexMap objects a and b
+         */
+        friend void swap(PoissonIndexMap &a, PoissonIndexMap &b);
+};
+
+#include "PoissonIndexMap.hpp"
+
+#endif
@@ -0,0 +1,63 @@
+PoissonIndexMap::PoissonIndexMap(const MyVector<string> &bwm_sep):
+    PoissonIndexMap(MyBitMask(bwm_sep)) {}
+
+PoissonIndexMap::PoissonIndexMap(const MyBitMask &mask): pixel_unknown(),
+    unknown_pixel(), r(mask.rows()), c(mask.cols()), n(mask.count())
+{
+    pixel_unknown = MyVector<int>(r * c);
+    unknown_pixel = MyVector<size_t>(n);
+    std::fill(pixel_unknown.begin(), pixel_unknown.end(), -1);
+
+    // number the unknowns bottom row first, left to right, matching the
+    // order the poisson system is assembled and solved in
+    int next_unknown = 0;
+    for(size_t i = r; i-- > 0; )
+    {
+        const uint64_t *words = mask.row_ptr(i);
+        int *pixel_row = pixel_unknown.data() + i * c;
+        for(size_t k = 0; k < mask.row_words(); k++)
+        {
+            for(uint64_t w = words[k]; w != 0; w &= w - 1)
+            {
+                const size_t j = k * MASK_WORD_BITS + mask_lowest_bit(w);
+                pixel_row[j] = next_unknown;
+                unknown_pixel[next_unknown] = i * c + j;
+                next_unknown++;
+            }
+        }
+    }
+}
+
+PoissonIndexMap::PoissonIndexMap(const PoissonIndexMap &pim):
+    pixel_unknown(pim.pixel_unknown), unknown_pixel(pim.unknown_pixel),
+    r(pim.r), c(pim.c), n(pim.n) {}
+
+PoissonIndexMap& PoissonIndexMap::operator=(PoissonIndexMap pim)
+{
+    swap(*this, pim);
+    return *this;
+}
+
+int PoissonIndexMap::operator()(const int i, const int j) const
+{
+    if(i < 0 || j < 0 || i >= int(r) || j >= int(c))
+        return -1;
+    return pixel_unknown.data()[i * c + j];
+}
+
+void PoissonIndexMap::pixel(const size_t k, int &i, int &j) const
+{
+    if(k >= n)
+        throw std::out_of_range("k out of range for poisson index map pixel()");
+    i = int(unknown_pixel.data()[k] / c);
+    j = int(unknown_pixel.data()[k] % c);
+}
+
+void swap(PoissonIndexMap &a, PoissonIndexMap &b)
+{
+    swap(a.pixel_unknown, b.pixel_unknown);
+    swap(a.unknown_pixel, b.unknown_pixel);
+    std::swap(a.r, b.r);
+    std::swap(a.c, b.c);
+    std::swap(a.n, b.n);
+}
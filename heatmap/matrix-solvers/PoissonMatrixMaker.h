@@ -2,47 +2,71 @@
 #define POISSON_MATRIX_MAKER_H
 
 #include "../containers/MyMatrix.h"
+#include "../containers/MySparseMatrix.h"
+#include "PoissonIndexMap.h"
+#include "../inputters/ImageInputter.h"
+#include <algorithm>
 #include <iostream>
 #include <fstream>
+#include <iterator>
 using std::cout;
 using std::endl;
 using std::string;
 
 /*!
- * @brief func to examine bwm_sep matrix in order, returning the index of 'des_j'th 'B' char
- * @pre des_j must be positive, bwm_sep must contain 'des_j' 'B' values
- * @param[in] bwm_sep vector of strings to iterate through to find 'B' values
- * @param[in] des_j the specific 'B' value to search for in the string vector
- * @param[out] j_i the i index of the desired 'B' value
- * @param[out] j_j the j index of the desired 'B' value
- * @throw std::out_of_range if there are not des_j unknowns, or if des_j not positive
- * @post find i, j values of desired 'B' value, return these through reference vars
+ * @brief function to assemble poisson banded matrix of a numbered b/w grid
+ * @pre index_map must number at least one unknown
+ * @param[in] index_map numbering of the unknowns ('B' pixels) of the grid
+ * @throw std::invalid_argument if index_map has no unknowns
+ * @post assembles one row per unknown: a 1 on the diagonal and -0.25 for
+ *       every neighboring unknown, in the numbering of index_map
+ * @returns the assembled banded poisson matrix, in sparse (CSR) form
  */
-void find_jth_unknown(const MyVector<string> bwm_sep, const int des_j, int &j_i, int &j_j);
+MySparseMatrix<double> assemble_poisson_matrix(const PoissonIndexMap &index_map);
 
 /*!
- * @brief func to get distance from 'B' value to next 'B' value above/below
- * @pre first_i, first_j, sec_i must all be in range of bwm_sep matrix
- * @param[in] bwm_sep vector of strings to iterate through to find 'B' values
- * @param[in] first_i i index value of the first 'B' value
- * @param[in] first_j j index value of the first 'B' value (and second 'B' value)
- * @param[in] sec_i i index value of the second 'B' value
- * @throw std::out_of_range if first_i, first_j, sec_i out of range of bwm_sep
- * @post gets the distance between the two desired 'B' values 
- * @returns the distance between two desired 'B' values
+ * @brief function to read the b/w grid of an input file, without assembling
+ * @pre bw_matrix must be a text file in root directory
+ * @param[in] bw_matrix name of text file to read
+ * @throw std::invalid_argument if bw_matrix cannot be opened
+ * @post reads every line of the file into its own string
+ * @returns vector of the strings read in by file, one per line
  */
-int get_unknown_dist(const MyVector<string> bwm_sep, const int first_i, const int first_j, const int sec_i);
+MyVector<string> read_bw_matrix(const string bw_matrix);
 
 /*!
  * @brief function to construct poisson banded matrix given input file
- * @pre bw_matrix must be a text file in root directory
- * @param[in] bw_matrix name of text file to create matrix from
- * @param[out] bwm vector of strings read in by file
- * @post construct a poisson matrix based on given text file name, returns
- *       the strings read in from file through bwm out parameter
- * @returns the constructed banded poisson matrix
+ * @pre bw_matrix must be a b/w text file, or a binary pgm/ppm image
+ * @param[in] bw_matrix name of file to create matrix from
+ * @param[out] bwm mask of the grid read in by file
+ * @throw std::invalid_argument if the grid has no unknowns
+ * @post construct a poisson matrix based on given file name, returns the
+ *       grid read in from file through bwm out parameter, one bit per pixel
+ * @returns the constructed banded poisson matrix, in sparse (CSR) form
+ */
+MySparseMatrix<double> calc_poisson_matrix(const string bw_matrix, MyBitMask &bwm);
+
+/*!
+ * @brief function to read the b/w grid of an input file straight into a mask
+ * @pre bw_matrix must be a b/w text file, or a binary pgm/ppm image
+ * @param[in] bw_matrix name of the file to read
+ * @throw std::invalid_argument if bw_matrix cannot be read
+ * @post thresholds the pixels of .pgm, .ppm and .pnm files in memory
+ *       (see read_pnm_mask); reads any other file twice, once to size the
+ *       grid and once to set its 'B' pixels, without storing its lines
+ * @returns mask of the grid, a set bit for every 'B' (dark) pixel
+ */
+MyBitMask read_bw_mask(const string bw_matrix);
+
+/*!
+ * @brief function to construct poisson banded matrix of a b/w mask
+ * @pre mask must contain at least one set pixel
+ * @param[in] mask b/w grid, a set bit for every 'B' pixel
+ * @throw std::invalid_argument if mask has no set pixels
+ * @post numbers the set pixels of mask and assembles their poisson system
+ * @returns the constructed banded poisson matrix, in sparse (CSR) form
  */
-MyMatrix<double> calc_poisson_matrix(const string bw_matrix, MyVector<string> &bwm);
+MySparseMatrix<double> calc_poisson_matrix(const MyBitMask &mask);
 
 /*!
  * @brief creates poisson b vector of size rows, filled with 'val'
@@ -1,142 +1,135 @@
-void find_jth_unknown(const MyVector<string> bwm_sep, const int des_j, int &j_i, int &j_j)
+MySparseMatrix<double> assemble_poisson_matrix(const PoissonIndexMap &index_map)
 {
-    if(des_j < 0)
-        throw std::out_of_range("des_j value in find_jth_unknown negative");
-        
-    int num_black = -1;
-    for(int i = int(bwm_sep.size() - 1); i >= 0; i--)
+    int num_unknowns = int(index_map.size());
+    if(num_unknowns == 0)
+        throw std::invalid_argument("cant assemble poisson matrix without unknowns");
+
+    // initialize n x n sparse system, where n = num_unknowns; each row holds
+    // at most 5 nonzeros (the unknown itself and its 4 neighbors), so only
+    // those are stored, and the b vector is all zeros (since boundaries
+    // are always equivalent to zero and only boundaries are in solution vector)
+    MySparseMatrix<double> poisson_system(num_unknowns, num_unknowns, 5);
+
+    // for each unknown (a 'B'), assign a 1 along the main diagonal, then look
+    // to all 4 adjacent char to see if it is a B, if it is update that
+    // information so that adjacent char contributes to the overall solution
+    // of that given unknown (add a -1/4); the largest neighbor distance (the
+    // half bandwidth, used by the banded cholesky) is tracked by the matrix
+    for(int j = 0; j < int(poisson_system.rows()); j++)
     {
-        for(int j = 0; j < int(bwm_sep[i].size()); j++)
+        int jth_unknown_i, jth_unknown_j = 0;
+        index_map.pixel(j, jth_unknown_i, jth_unknown_j);
+        poisson_system.insert(j, 1);
+
+        // examine the letters to the right, left, below and above; pixels
+        // outside the grid or not 'B' map to -1
+        const int neighbors[4] = {
+            index_map(jth_unknown_i, jth_unknown_j + 1),
+            index_map(jth_unknown_i, jth_unknown_j - 1),
+            index_map(jth_unknown_i + 1, jth_unknown_j),
+            index_map(jth_unknown_i - 1, jth_unknown_j)
+        };
+        for(const int neighbor : neighbors)
         {
-            num_black += (bwm_sep[i][j] == 'B') ? 1 : 0;
-            if(num_black == int(des_j))
-            {
-                j_i = i;
-                j_j = j;
-                return;
-            }
+            if(neighbor < 0)
+                continue;
+            poisson_system.insert(neighbor, -0.25);
         }
+        poisson_system.end_row();
     }
-    throw std::out_of_range("could not find jth unknown, there aren't j unknowns");
-}
 
-int get_unknown_dist(const MyVector<string> bwm_sep, const int first_i, 
-    const int first_j, const int sec_i)
-{
-    // if index values are out of range, throw relevant error
-    if(first_i < 0 || first_i >= int(bwm_sep.size()))
-        throw std::out_of_range("first_i in get_unknown_dist out of range");
-    if(first_j < 0 || first_j >= int(bwm_sep[0].size()))
-        throw std::out_of_range("first_j in get_unknown_dist out of range");
-    if(sec_i < 0 || sec_i >= int(bwm_sep.size()))
-        throw std::out_of_range("sec_i in get_unknown_dist out of range");
-
-    int dist = 0;
-    // if the first 'B' value is closer to the beginning, iterate up to second 'B'
-    if(first_i > sec_i)
-    {
-        for(int j = first_j + 1; j < int(bwm_sep[first_i].size()); j++)
-            dist += (bwm_sep[first_i][j] == 'B') ? 1 : 0;
-        for(int j = 0; j <= first_j; j++)
-            dist += (bwm_sep[sec_i][j] == 'B') ? 1 : 0;
-    }
-    // if the second 'B' value is closer to the beginning, iterate down to second 'B'
-    else
-    {
-        for(int j = first_j - 1; j >= 0; j--)
-            dist += (bwm_sep[first_i][j] == 'B') ? 1 : 0;
-        for(int j = int(bwm_sep[first_i].size() - 1); j >= first_j; j--)
-            dist += (bwm_sep[sec_i][j] == 'B') ? 1 : 0;
-    }
-    return dist;
+    return poisson_system;
 }
 
-MyMatrix<double> calc_poisson_matrix(const string bw_matrix, MyVector<string> &bwm)
+MyVector<string> read_bw_matrix(const string bw_matrix)
 {
     // open up black and white matrix
     std::ifstream input_file;
     input_file.open(bw_matrix);
-    
-    // count the number of lines and number of unknowns in file, and also
-    // save the contents of the file to a string vector for later usage
+    if(!input_file)
+        throw std::invalid_argument("cant open b/w matrix: " + bw_matrix);
+
+    // save the contents of the file to a string vector for later usage;
+    // push_back grows the vector geometrically, so reading stays linear in
+    // the number of lines
     string bw_line;
-    int num_unknowns = 0;
-    int num_lines = 0;
     MyVector<string> bwm_sep(0);
     while(getline(input_file, bw_line))
-    {
-        bwm_sep.resize(num_lines + 1);
-        for(size_t i = 0; i < bw_line.size(); i++)
-            num_unknowns += (bw_line[i] == 'B') ? 1 : 0;
-        bwm_sep[num_lines] = bw_line;
-        num_lines++;
-    }
+        bwm_sep.push_back(std::move(bw_line));
     input_file.close();
 
-    // initialize n x (n+1) augmented matrix, where n = num_unknowns, and
-    // the b portion of [A b] augmented matrix all set to zero (since boundaries
-    // are always equivalent to zero and only boundaries are in solution vector)
-    MyMatrix<double> poisson_system(num_unknowns, num_unknowns);
+    return bwm_sep;
+}
 
-    // along the main diagonal of the system, assign a 1; along the b vector
-    // of the augmented [A b] matrix, assign a 0
-    for(size_t i = 0; i < poisson_system.rows(); i++)
-        poisson_system[i][i] = 1;
+MySparseMatrix<double> calc_poisson_matrix(const string bw_matrix, MyBitMask &bwm)
+{
+    MyBitMask mask = read_bw_mask(bw_matrix);
 
-    // for each unknown (a 'B'), look to all 4 adjacent char to see if it is
-    // a B, if it is update that information so that adjacent char contributes
-    // to the overall solution of that given unknown (add a -1/4)
-    int largest_dist = 0;
-    for(int j = 0; j < int(poisson_system.rows()); j++)
-    {
-        int jth_unknown_i, jth_unknown_j = 0;
-        find_jth_unknown(bwm_sep, j, jth_unknown_i, jth_unknown_j);
+    // count and number every unknown in one pass over the words of the
+    // mask, so each unknown's pixel and each neighbor's unknown number are
+    // O(1) lookups instead of rescans of the grid
+    MySparseMatrix<double> poisson_system = calc_poisson_matrix(mask);
 
-        // examine the letter to the right
-        if(jth_unknown_j + 1 < int(bwm_sep[jth_unknown_i].size()))
-        {
-            if(bwm_sep[jth_unknown_i][jth_unknown_j + 1] == 'B') 
-                poisson_system[j][j + 1] = -0.25;
-        }
+    swap(bwm, mask);
 
-        // examine the letter to the left
-        if(jth_unknown_j - 1 >= 0)
-        {
-            if(bwm_sep[jth_unknown_i][jth_unknown_j - 1] == 'B')
-                poisson_system[j][j - 1] = -0.25;
-        }
+    return poisson_system;
+}
+
+MyBitMask read_bw_mask(const string bw_matrix)
+{
+    if(is_pnm_path(bw_matrix))
+        return read_pnm_mask(bw_matrix);
+
+    std::ifstream input_file;
+    input_file.open(bw_matrix);
+    if(!input_file)
+        throw std::invalid_argument("cant open b/w matrix: " + bw_matrix);
 
-        // examine the letter below
-        if(jth_unknown_i + 1 < int(bwm_sep.size()))
+    // first pass sizes the grid: one row per line (a last line without a
+    // newline included, as getline reads it), as wide as the longest line
+    size_t rows = 0, cols = 0, len = 0;
+    std::istreambuf_iterator<char> it(input_file), end;
+    for(; it != end; ++it)
+    {
+        if(*it != '\n')
         {
-            if(bwm_sep[jth_unknown_i + 1][jth_unknown_j] == 'B')
-            {
-                int dist = get_unknown_dist(bwm_sep, jth_unknown_i, jth_unknown_j, jth_unknown_i + 1);
-                poisson_system[j][j - dist] = -0.25;
-
-                if(dist > largest_dist)
-                    largest_dist = dist;
-            }
+            len++;
+            continue;
         }
+        cols = std::max(cols, len);
+        rows++;
+        len = 0;
+    }
+    if(len > 0)
+    {
+        cols = std::max(cols, len);
+        rows++;
+    }
 
-        // examine the letter above
-        if(jth_unknown_i - 1 >= 0)
+    // second pass sets the 'B' pixels straight into the mask, so the file
+    // is never held in memory as text
+    MyBitMask mask(rows, cols);
+    input_file.clear();
+    input_file.seekg(0);
+    size_t i = 0, j = 0;
+    for(it = std::istreambuf_iterator<char>(input_file); it != end; ++it)
+    {
+        if(*it == '\n')
         {
-            if(bwm_sep[jth_unknown_i - 1][jth_unknown_j] == 'B')
-            {
-                int dist = get_unknown_dist(bwm_sep, jth_unknown_i, jth_unknown_j, jth_unknown_i - 1);
-                poisson_system[j][j + dist] = -0.25;
-
-                if(dist > largest_dist)
-                    largest_dist = dist;
-            }
+            i++;
+            j = 0;
+            continue;
         }
+        if(*it == 'B')
+            mask.set(i, j, true);
+        j++;
     }
+    return mask;
+}
 
-    bwm.resize(bwm_sep.size());
-    bwm = bwm_sep;
-    
-    return poisson_system;
+MySparseMatrix<double> calc_poisson_matrix(const MyBitMask &mask)
+{
+    return assemble_poisson_matrix(PoissonIndexMap(mask));
 }
 
 MyVector<double> calc_poisson_vector(const int rows, const double val)
@@ -145,7 +138,6 @@ MyVector<double> calc_poisson_vector(const int rows, const double val)
         throw std::out_of_range("cant make poisson b vect of neg. size");
 
     MyVector<double> b(rows);
-    for(size_t i = 0; i < b.size(); i++)
-        b[i] = val;
+    std::fill(b.begin(), b.end(), val);
     return b;
 }
\ No newline at end of file
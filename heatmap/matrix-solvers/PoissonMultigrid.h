@@ -0,0 +1,305 @@
+#ifndef POISSON_MULTIGRID_H
+#define POISSON_MULTIGRID_H
+
+#include "../containers/MyMatrix.h"
+#include "../containers/MyVector.h"
+#include "PoissonIndexMap.h"
+#include "PoissonMatrixMaker.h"
+#include "CholeskyDecomp.h"
+#include "ConvergenceHistory.h"
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+/*! amount of unknowns below which a level is not coarsened any further and
+ *  is instead solved directly by cholesky
+ */
+const size_t MULTIGRID_COARSEST_SIZE = 1024;
+
+/*!
+ * @brief poisson multigrid class, a functor to wrap around geometric
+ *        multigrid (v-cycle and full multigrid) on the masked b/w grid
+ */
+class PoissonMultigrid;
+
+/*!
+ * @brief swap function, swaps contents of a and b
+ * @pre none
+ * @param[in,out] a lhs of PoissonMultigrid swap
+ * @param[in,out] b rhs of PoissonMultigrid swap
+ * @post swaps the contents of PoissonMultigrid objects a and b
+ */
+void swap(PoissonMultigrid &a, PoissonMultigrid &b);
+
+/*!
+ * @brief poisson multigrid class, a functor to wrap around geometric
+ *        multigrid (v-cycle and full multigrid) on the masked b/w grid;
+ *        every level stores its grid functions on a zero padded 2d grid, the
+ *        finest level applies the 5 point stencil straight from the mask and
+ *        each coarser level keeps the 9 point galerkin stencil R A P of the
+ *        level below, so the masked boundary is coarsened consistently
+ */
+class PoissonMultigrid
+{
+    private:
+        PoissonIndexMap index_map; //! numbering of the unknowns on finest grid
+        std::vector<MyMatrix<char>> active; //! 1 where a level has an unknown
+        std::vector<MyMatrix<double>> u; //! solution (or error) on each level
+        std::vector<MyMatrix<double>> f; //! right hand side on each level
+        std::vector<MyMatrix<double>> res; //! residual on each level
+        std::vector<MyMatrix<double>> stencil; //! 9 coefficients per pixel of
+                                               //! each coarse level, level 0
+                                               //! uses the fixed 5 point one
+        PoissonIndexMap coarse_map; //! numbering of unknowns on coarsest grid
+        CholeskyDecomp coarse_solver; //! factor of the coarsest level operator
+        size_t pre_smooth; //! smoothing sweeps before each coarse correction
+        size_t post_smooth; //! smoothing sweeps after each coarse correction
+        double w; //! relaxation parameter of the smoother, 1 is gauss-seidel
+        ConvergenceHistory history; //! residuals and timings of last solve
+
+        /*!
+         * @brief helper function, sets every element of grid to zero
+         * @pre none
+         * @param[in,out] grid grid function to clear
+         * @post zeroes grid in place, without reallocating it
+         */
+        static void zero_grid(MyMatrix<double> &grid);
+
+        /*!
+         * @brief helper function, coefficient of A_l coupling two pixels
+         * @pre l must be a level of the hierarchy, (i, j) a padded pixel with
+         *      an unknown, |di| <= 1 and |dj| <= 1
+         * @param[in] l level of the operator
+         * @param[in] i padded row of the pixel
+         * @param[in] j padded col of the pixel
+         * @param[in] di row offset of the coupled pixel
+         * @param[in] dj col offset of the coupled pixel
+         * @post looks up the stencil of level l at (i, j)
+         * @returns the coefficient of pixel (i + di, j + dj) in row (i, j)
+         */
+        double coefficient(const size_t l, const size_t i, const size_t j,
+            const int di, const int dj) const;
+
+        /*!
+         * @brief helper function, builds galerkin stencil of level l + 1
+         * @pre level l must be complete, active[l + 1] must be set
+         * @param[in] l level to coarsen
+         * @post sets stencil[l + 1] to R A_l P, with P bilinear interpolation
+         *       onto the unknowns of level l and R its transpose
+         */
+        void coarsen_operator(const size_t l);
+
+        /*!
+         * @brief helper function, gauss-seidel/sor sweeps on level l
+         * @pre l must be a level of the hierarchy
+         * @param[in] l level to smooth on
+         * @param[in] sweeps amount of sweeps to perform
+         * @param[in] reverse if true, sweep in the opposite order, so the
+         *            post smoothing mirrors the pre smoothing
+         * @post relaxes u[l] towards the solution of A_l u = f[l] with the
+         *       successiveor update x += w * ((b - sum) / diag - x); red-black
+         *       order on the 5 point finest level, lexicographic on coarser
+         */
+        void smooth(const size_t l, const size_t sweeps, const bool reverse);
+
+        /*!
+         * @brief helper function, computes residual f - A_l u on level l
+         * @pre l must be a level of the hierarchy
+         * @param[in] l level to compute residual on
+         * @post overwrites res[l], zero outside the unknowns
+         * @returns the 2-norm of the residual
+         */
+        double residual(const size_t l);
+
+        /*!
+         * @brief helper function, restriction of level l to level l + 1
+         * @pre l + 1 must be a level of the hierarchy
+         * @param[in] fine grid function on level l
+         * @param[out] coarse grid function on level l + 1
+         * @param[in] l level the fine grid function lives on
+         * @post coarse unknown (I, J) is the 1/4 [1 2 1; 2 4 2; 1 2 1]
+         *       weighted sum of fine grid around pixel (2I, 2J), which is the
+         *       transpose of the bilinear interpolation
+         */
+        void restrict_to(const MyMatrix<double> &fine, MyMatrix<double> &coarse,
+            const size_t l) const;
+
+        /*!
+         * @brief helper function, adds bilinear interpolation of level l+1 to l
+         * @pre l + 1 must be a level of the hierarchy
+         * @param[in] coarse grid function on level l + 1
+         * @param[in,out] fine grid function on level l, added to
+         * @param[in] l level the fine grid function lives on
+         * @post adds the bilinear interpolation of coarse to every unknown of
+         *       fine, coarse values outside its unknowns count as zero
+         */
+        void prolong_add(const MyMatrix<double> &coarse, MyMatrix<double> &fine,
+            const size_t l) const;
+
+        /*!
+         * @brief helper function, one v-cycle on level l
+         * @pre l must be a level of the hierarchy
+         * @param[in] l level to cycle on
+         * @post performs one v-cycle on A_l u[l] = f[l], solving the coarsest
+         *       level directly with the cholesky factor
+         */
+        void v_cycle(const size_t l);
+
+        /*!
+         * @brief helper function, solves the coarsest level directly
+         * @pre none
+         * @post overwrites u on the coarsest level with the exact solution
+         */
+        void coarse_solve();
+
+        /*!
+         * @brief helper function, scatters b vector onto the finest grid
+         * @pre b must have one element per unknown
+         * @param[in] b rhs of linear system Ax = b, in unknown order
+         * @throw std::invalid_argument if b is not one element per unknown
+         * @post sets f on finest level from b, zeroes u on every level
+         */
+        void load_rhs(const MyVector<double> &b);
+
+        /*!
+         * @brief helper function, gathers the finest grid solution
+         * @pre none
+         * @post reads u on the finest level back in unknown order
+         * @returns the solution vector, in unknown order
+         */
+        MyVector<double> gather_solution() const;
+
+        /*!
+         * @brief helper function, v-cycles until residual is small enough
+         * @pre load_rhs must have been called
+         * @param[in] f_norm 2-norm of the right hand side
+         * @param[in] tol relative residual to stop at
+         * @param[in] max_cycles most v-cycles to run
+         * @post records every cycle in history until converged or out of
+         *       cycles
+         */
+        void iterate(const double f_norm, const double tol, const size_t max_cycles);
+
+    public:
+        /*!
+         * @brief default constructor, creates multigrid of an empty grid
+         * @pre none
+         * @post creates poissonmultigrid object without levels
+         */
+        PoissonMultigrid(): pre_smooth(2), post_smooth(2), w(1) {}
+
+        /*!
+         * @brief param. constructor, builds the grid hierarchy of bwm_sep
+         * @pre bwm_sep must contain at least one 'B' pixel
+         * @param[in] bwm_sep vector of strings, one per line of the b/w grid
+         * @param[in] pre_sweeps smoothing sweeps before coarse correction
+         * @param[in] post_sweeps smoothing sweeps after coarse correction
+         * @param[in] omega relaxation parameter of smoother, 1 is gauss-seidel
+         * @throw std::invalid_argument if bwm_sep has no unknowns or omega is
+         *        not in (0, 2)
+         * @post halves the grid until it is small, a coarse pixel (I, J) is an
+         *       unknown if fine pixel (2I, 2J) is; builds the galerkin stencil
+         *       of every coarse level and factors the coarsest level
+         */
+        explicit PoissonMultigrid(const MyVector<string> &bwm_sep,
+            const size_t pre_sweeps = 2, const size_t post_sweeps = 2,
+            const double omega = 1);
+
+        /*!
+         * @brief param. constructor, builds the grid hierarchy of mask
+         * @pre mask must contain at least one set pixel
+         * @param[in] mask b/w grid, a set bit for every 'B' pixel
+         * @param[in] pre_sweeps smoothing sweeps before coarse correction
+         * @param[in] post_sweeps smoothing sweeps after coarse correction
+         * @param[in] omega relaxation parameter of smoother, 1 is gauss-seidel
+         * @throw std::invalid_argument if mask has no set pixels or omega is
+         *        not in (0, 2)
+         * @post same hierarchy as the b/w text grid with the same pixels
+         */
+        explicit PoissonMultigrid(const MyBitMask &mask,
+            const size_t pre_sweeps = 2, const size_t post_sweeps = 2,
+            const double omega = 1);
+
+        /*!
+         * @brief copy constructor, given existing poissonmultigrid object
+         * @pre none
+         * @param[in] pm existing poissonmultigrid object to copy
+         * @post creates poissonmultigrid object identical to pm
+         */
+        PoissonMultigrid(const PoissonMultigrid &pm);
+
+        /*!
+         * @brief assignment operator, assigns calling object equal to pm
+         * @pre none
+         * @param[in] pm copy of poissonmultigrid object to swap with
+         * @post swaps contents of calling object and the copy pm
+         * @returns the modified calling object after assignment
+         */
+        PoissonMultigrid& operator=(PoissonMultigrid pm);
+
+        /*!
+         * @brief eval operator, solves Ax = b by repeated v-cycles from x = 0
+         * @pre tol must be positive, b must have one element per unknown
+         * @param[in] b rhs of linear system Ax = b, in unknown order
+         * @param[in] tol relative residual ||b - Ax|| / ||b|| to stop at
+         * @param[in] max_cycles most v-cycles to run before giving up
+         * @throw std::invalid_argument if tol not positive or b wrong size
+         * @post v-cycles until the relative residual is below tol, recording
+         *       every cycle in history; each cycle costs O(n)
+         * @returns solution vector x, in unknown order
+         */
+        MyVector<double> operator()(const MyVector<double> &b, const double tol,
+            const size_t max_cycles);
+
+        /*!
+         * @brief full multigrid solve, solves Ax = b coarse to fine
+         * @pre tol must be positive, b must have one element per unknown
+         * @param[in] b rhs of linear system Ax = b, in unknown order
+         * @param[in] tol relative residual ||b - Ax|| / ||b|| to stop at
+         * @param[in] max_cycles most v-cycles to run after the fmg pass
+         * @throw std::invalid_argument if tol not positive or b wrong size
+         * @post solves the coarsest level, interpolating each solution as the
+         *       start of one v-cycle on the next finer level, then v-cycles on
+         *       the finest level until the relative residual is below tol
+         * @returns solution vector x, in unknown order
+         */
+        MyVector<double> full_multigrid(const MyVector<double> &b,
+            const double tol, const size_t max_cycles);
+
+        /*!
+         * @brief levels function, returns amount of grids in the hierarchy
+         * @pre none
+         * @post gets the amount of levels, including finest and coarsest
+         * @returns the amount of levels in the hierarchy
+         */
+        size_t levels() const { return u.size(); }
+
+        /*!
+         * @brief size function, returns amount of unknowns on finest grid
+         * @pre none
+         * @post gets the amount of unknowns on the finest grid
+         * @returns the amount of unknowns on the finest grid
+         */
+        size_t size() const { return index_map.size(); }
+
+        /*!
+         * @brief history function, returns the record of the last solve
+         * @pre none
+         * @post gets cycle count, residual norms and timings of last solve
+         * @returns the convergence history of the last solve
+         */
+        const ConvergenceHistory& get_history() const { return history; }
+
+        /*!
+         * @brief swap function, swaps contents of a and b
+         * @pre none
+         * @param[in,out] a lhs of PoissonMultigrid swap
+         * @param[in,out] b rhs of PoissonMultigrid swap
+         * @post swaps the contents of PoissonMultigrid objects a and b
+         */
+        friend void swap(PoissonMultigrid &a, PoissonMultigrid &b);
+};
+
+#include "PoissonMultigrid.hpp"
+
+#endif
@@ -0,0 +1,521 @@
+PoissonMultigrid::PoissonMultigrid(const MyVector<string> &bwm_sep,
+    const size_t pre_sweeps, const size_t post_sweeps, const double omega):
+    PoissonMultigrid(MyBitMask(bwm_sep), pre_sweeps, post_sweeps, omega) {}
+
+PoissonMultigrid::PoissonMultigrid(const MyBitMask &mask,
+    const size_t pre_sweeps, const size_t post_sweeps, const double omega):
+    index_map(mask), pre_smooth(pre_sweeps), post_smooth(post_sweeps),
+    w(omega)
+{
+    if(index_map.size() == 0)
+        throw std::invalid_argument("multigrid given grid without unknowns");
+    if(w <= 0 || w >= 2)
+        throw std::invalid_argument("omega invalid for poissonmultigrid smoother");
+
+    // finest level, padded by one pixel of zero boundary on every side so
+    // the stencil never needs a bounds check
+    size_t rows = index_map.rows();
+    size_t cols = index_map.cols();
+    active.push_back(MyMatrix<char>(rows + 2, cols + 2));
+    for(size_t i = 0; i < rows; i++)
+        for(size_t j = 0; j < cols; j++)
+            active[0](i + 1, j + 1) = (index_map(i, j) >= 0) ? 1 : 0;
+    stencil.push_back(MyMatrix<double>());
+
+    // halve the grid while the level is still large, coarse pixel (I, J)
+    // sits on top of fine pixel (2I, 2J) and is an unknown if that pixel is
+    size_t unknowns = index_map.size();
+    while(unknowns > MULTIGRID_COARSEST_SIZE && rows >= 3 && cols >= 3)
+    {
+        size_t coarse_rows = (rows + 1) / 2;
+        size_t coarse_cols = (cols + 1) / 2;
+        MyMatrix<char> coarse(coarse_rows + 2, coarse_cols + 2);
+        const MyMatrix<char> &fine = active.back();
+        size_t coarse_unknowns = 0;
+        for(size_t i = 0; i < coarse_rows; i++)
+        {
+            for(size_t j = 0; j < coarse_cols; j++)
+            {
+                coarse(i + 1, j + 1) = fine(2 * i + 1, 2 * j + 1);
+                coarse_unknowns += coarse(i + 1, j + 1);
+            }
+        }
+
+        // a mask of thin lines can vanish when coarsened, keep the last
+        // level that still has unknowns as the coarsest
+        if(coarse_unknowns == 0)
+            break;
+        active.push_back(coarse);
+        stencil.push_back(MyMatrix<double>(coarse_rows + 2, 9 * (coarse_cols + 2)));
+        coarsen_operator(active.size() - 2);
+        rows = coarse_rows;
+        cols = coarse_cols;
+        unknowns = coarse_unknowns;
+    }
+
+    for(size_t l = 0; l < active.size(); l++)
+    {
+        u.push_back(MyMatrix<double>(active[l].rows(), active[l].cols()));
+        f.push_back(MyMatrix<double>(active[l].rows(), active[l].cols()));
+        res.push_back(MyMatrix<double>(active[l].rows(), active[l].cols()));
+    }
+
+    // the coarsest level is small, so it is assembled and factored once
+    if(levels() == 1)
+    {
+        coarse_map = index_map;
+        coarse_solver.factorize(assemble_poisson_matrix(coarse_map));
+        return;
+    }
+
+    size_t l = levels() - 1;
+    MyBitMask coarse_mask(rows, cols);
+    for(size_t i = 0; i < rows; i++)
+        for(size_t j = 0; j < cols; j++)
+            if(active[l](i + 1, j + 1))
+                coarse_mask.set(i, j, true);
+    coarse_map = PoissonIndexMap(coarse_mask);
+
+    MySparseMatrix<double> coarse_system(coarse_map.size(), coarse_map.size(), 9);
+    int i, j = 0;
+    for(size_t k = 0; k < coarse_map.size(); k++)
+    {
+        coarse_map.pixel(k, i, j);
+        for(int di = -1; di <= 1; di++)
+        {
+            for(int dj = -1; dj <= 1; dj++)
+            {
+                int neighbor = coarse_map(i + di, j + dj);
+                double coef = coefficient(l, i + 1, j + 1, di, dj);
+                if(neighbor >= 0 && coef != 0)
+                    coarse_system.insert(neighbor, coef);
+            }
+        }
+        coarse_system.end_row();
+    }
+    coarse_solver.factorize(coarse_system);
+}
+
+PoissonMultigrid::PoissonMultigrid(const PoissonMultigrid &pm):
+    index_map(pm.index_map), active(pm.active), u(pm.u), f(pm.f),
+    res(pm.res), stencil(pm.stencil), coarse_map(pm.coarse_map),
+    coarse_solver(pm.coarse_solver), pre_smooth(pm.pre_smooth),
+    post_smooth(pm.post_smooth), w(pm.w), history(pm.history) {}
+
+PoissonMultigrid& PoissonMultigrid::operator=(PoissonMultigrid pm)
+{
+    swap(*this, pm);
+    return *this;
+}
+
+void PoissonMultigrid::zero_grid(MyMatrix<double> &grid)
+{
+    std::fill(grid.data(), grid.data() + grid.rows() * grid.stride(), 0.0);
+}
+
+double PoissonMultigrid::coefficient(const size_t l, const size_t i,
+    const size_t j, const int di, const int dj) const
+{
+    if(l == 0)
+    {
+        if(di == 0 && dj == 0)
+            return 1;
+        return (di == 0 || dj == 0) ? -0.25 : 0;
+    }
+    return stencil[l].data()[i * stencil[l].stride() + 9 * j + (di + 1) * 3 + (dj + 1)];
+}
+
+void PoissonMultigrid::coarsen_operator(const size_t l)
+{
+    const MyMatrix<char> &fine = active[l];
+    const MyMatrix<char> &coarse = active[l + 1];
+    MyMatrix<double> &coarse_stencil = stencil[l + 1];
+    const int fine_rows = int(fine.rows());
+    const int fine_cols = int(fine.cols());
+
+    // bilinear interpolation weight of a fine pixel offset (a, b) from the
+    // fine pixel under a coarse pixel
+    const double weight[3] = {0.5, 1, 0.5};
+
+    for(size_t ci = 1; ci + 1 < coarse.rows(); ci++)
+    {
+        for(size_t cj = 1; cj + 1 < coarse.cols(); cj++)
+        {
+            if(!coarse(ci, cj))
+                continue;
+
+            // column (ci, cj) of P, then A_l times it, both on the 5x5 fine
+            // pixels around the center (2ci - 1, 2cj - 1); pixels without
+            // an unknown are not part of the fine system and stay zero
+            const int fi = int(2 * ci - 1);
+            const int fj = int(2 * cj - 1);
+            double p_col[5][5] = {};
+            double ap_col[5][5] = {};
+            for(int a = -1; a <= 1; a++)
+                for(int b = -1; b <= 1; b++)
+                    if(fine(fi + a, fj + b))
+                        p_col[a + 2][b + 2] = weight[a + 1] * weight[b + 1];
+
+            for(int a = -2; a <= 2; a++)
+            {
+                for(int b = -2; b <= 2; b++)
+                {
+                    int pi = fi + a;
+                    int pj = fj + b;
+                    if(pi < 1 || pj < 1 || pi + 1 >= fine_rows
+                        || pj + 1 >= fine_cols || !fine(pi, pj))
+                        continue;
+                    double sum = 0;
+                    for(int di = -1; di <= 1; di++)
+                    {
+                        for(int dj = -1; dj <= 1; dj++)
+                        {
+                            int qa = a + di;
+                            int qb = b + dj;
+                            if(qa < -2 || qa > 2 || qb < -2 || qb > 2)
+                                continue;
+                            sum += coefficient(l, pi, pj, di, dj) * p_col[qa + 2][qb + 2];
+                        }
+                    }
+                    ap_col[a + 2][b + 2] = sum;
+                }
+            }
+
+            // row (ci + dI, cj + dJ) of R = P(t) applied to A_l P gives the
+            // coupling of that coarse pixel to (ci, cj)
+            for(int dI = -1; dI <= 1; dI++)
+            {
+                for(int dJ = -1; dJ <= 1; dJ++)
+                {
+                    double sum = 0;
+                    if(coarse(ci + dI, cj + dJ))
+                    {
+                        for(int a = -1; a <= 1; a++)
+                        {
+                            for(int b = -1; b <= 1; b++)
+                            {
+                                int qa = 2 * dI + a;
+                                int qb = 2 * dJ + b;
+                                if(qa < -2 || qa > 2 || qb < -2 || qb > 2)
+                                    continue;
+                                sum += weight[a + 1] * weight[b + 1] * ap_col[qa + 2][qb + 2];
+                            }
+                        }
+                    }
+                    // A is symmetric, so the coupling of (ci + dI, cj + dJ)
+                    // to (ci, cj) is also the coupling of (ci, cj) to it
+                    coarse_stencil(ci, 9 * cj + (dI + 1) * 3 + (dJ + 1)) = sum;
+                }
+            }
+        }
+    }
+}
+
+void PoissonMultigrid::smooth(const size_t l, const size_t sweeps,
+    const bool reverse)
+{
+    MyMatrix<double> &x = u[l];
+    const MyMatrix<double> &b = f[l];
+    const MyMatrix<char> &act = active[l];
+    const size_t rows = act.rows() - 2;
+    const size_t cols = act.cols() - 2;
+
+    if(l == 0)
+    {
+        for(size_t sweep = 0; sweep < sweeps; sweep++)
+        {
+            // red-black order, pixels of one color only couple to the other
+            for(size_t c = 0; c < 2; c++)
+            {
+                size_t color = reverse ? 1 - c : c;
+                for(size_t i = 1; i <= rows; i++)
+                {
+                    double *x_row = x.data() + i * x.stride();
+                    const double *x_up = x_row - x.stride();
+                    const double *x_down = x_row + x.stride();
+                    const double *b_row = b.data() + i * b.stride();
+                    const char *act_row = act.data() + i * act.stride();
+                    for(size_t j = ((i + color) % 2 == 1) ? 1 : 2; j <= cols; j += 2)
+                    {
+                        if(!act_row[j])
+                            continue;
+                        double sum = -0.25 * (x_up[j] + x_down[j] + x_row[j - 1] + x_row[j + 1]);
+                        x_row[j] = x_row[j] + w * ((b_row[j] - sum) - x_row[j]);
+                    }
+                }
+            }
+        }
+        return;
+    }
+
+    // the 9 point galerkin stencil couples diagonal neighbors too, so the
+    // coarse levels sweep lexicographically, backwards when reversed
+    const MyMatrix<double> &st = stencil[l];
+    for(size_t sweep = 0; sweep < sweeps; sweep++)
+    {
+        for(size_t step = 0; step < rows; step++)
+        {
+            size_t i = reverse ? rows - step : step + 1;
+            double *x_row = x.data() + i * x.stride();
+            const double *x_up = x_row - x.stride();
+            const double *x_down = x_row + x.stride();
+            const double *b_row = b.data() + i * b.stride();
+            const char *act_row = act.data() + i * act.stride();
+            const double *st_row = st.data() + i * st.stride();
+            for(size_t col_step = 0; col_step < cols; col_step++)
+            {
+                size_t j = reverse ? cols - col_step : col_step + 1;
+                if(!act_row[j])
+                    continue;
+                const double *s = st_row + 9 * j;
+                double sum = s[0] * x_up[j - 1] + s[1] * x_up[j] + s[2] * x_up[j + 1]
+                    + s[3] * x_row[j - 1] + s[5] * x_row[j + 1]
+                    + s[6] * x_down[j - 1] + s[7] * x_down[j] + s[8] * x_down[j + 1];
+                x_row[j] = x_row[j] + w * (((b_row[j] - sum) / s[4]) - x_row[j]);
+            }
+        }
+    }
+}
+
+double PoissonMultigrid::residual(const size_t l)
+{
+    const MyMatrix<double> &x = u[l];
+    const MyMatrix<double> &b = f[l];
+    const MyMatrix<char> &act = active[l];
+    MyMatrix<double> &r = res[l];
+
+    double norm = 0;
+    for(size_t i = 1; i + 1 < act.rows(); i++)
+    {
+        const double *x_row = x.data() + i * x.stride();
+        const double *x_up = x_row - x.stride();
+        const double *x_down = x_row + x.stride();
+        const double *b_row = b.data() + i * b.stride();
+        const char *act_row = act.data() + i * act.stride();
+        double *r_row = r.data() + i * r.stride();
+        for(size_t j = 1; j + 1 < act.cols(); j++)
+        {
+            if(!act_row[j])
+            {
+                r_row[j] = 0;
+                continue;
+            }
+
+            double ax = 0;
+            if(l == 0)
+                ax = x_row[j] - 0.25 * (x_up[j] + x_down[j] + x_row[j - 1] + x_row[j + 1]);
+            else
+            {
+                const double *s = stencil[l].data() + i * stencil[l].stride() + 9 * j;
+                ax = s[0] * x_up[j - 1] + s[1] * x_up[j] + s[2] * x_up[j + 1]
+                    + s[3] * x_row[j - 1] + s[4] * x_row[j] + s[5] * x_row[j + 1]
+                    + s[6] * x_down[j - 1] + s[7] * x_down[j] + s[8] * x_down[j + 1];
+            }
+            r_row[j] = b_row[j] - ax;
+            norm += r_row[j] * r_row[j];
+        }
+    }
+    return std::sqrt(norm);
+}
+
+void PoissonMultigrid::restrict_to(const MyMatrix<double> &fine,
+    MyMatrix<double> &coarse, const size_t l) const
+{
+    const MyMatrix<char> &act = active[l + 1];
+    for(size_t i = 1; i + 1 < act.rows(); i++)
+    {
+        const char *act_row = act.data() + i * act.stride();
+        double *c_row = coarse.data() + i * coarse.stride();
+
+        // padded coarse (i, j) is padded fine (2i - 1, 2j - 1)
+        const double *f_mid = fine.data() + (2 * i - 1) * fine.stride();
+        const double *f_up = f_mid - fine.stride();
+        const double *f_down = f_mid + fine.stride();
+        for(size_t j = 1; j + 1 < act.cols(); j++)
+        {
+            if(!act_row[j])
+            {
+                c_row[j] = 0;
+                continue;
+            }
+            size_t fj = 2 * j - 1;
+            c_row[j] = (4 * f_mid[fj]
+                + 2 * (f_mid[fj - 1] + f_mid[fj + 1] + f_up[fj] + f_down[fj])
+                + f_up[fj - 1] + f_up[fj + 1] + f_down[fj - 1] + f_down[fj + 1])
+                / 4;
+        }
+    }
+}
+
+void PoissonMultigrid::prolong_add(const MyMatrix<double> &coarse,
+    MyMatrix<double> &fine, const size_t l) const
+{
+    const MyMatrix<char> &act = active[l];
+    for(size_t i = 0; i + 2 < act.rows(); i++)
+    {
+        const char *act_row = act.data() + (i + 1) * act.stride();
+        double *f_row = fine.data() + (i + 1) * fine.stride();
+
+        // fine pixel i lies on coarse row i / 2, or halfway to the next one
+        const double *c_row = coarse.data() + (i / 2 + 1) * coarse.stride();
+        const double *c_next = (i % 2 == 1) ? c_row + coarse.stride() : c_row;
+        for(size_t j = 0; j + 2 < act.cols(); j++)
+        {
+            if(!act_row[j + 1])
+                continue;
+            size_t cj = j / 2 + 1;
+            size_t cj_next = (j % 2 == 1) ? cj + 1 : cj;
+            f_row[j + 1] += 0.25 * (c_row[cj] + c_row[cj_next] + c_next[cj] + c_next[cj_next]);
+        }
+    }
+}
+
+void PoissonMultigrid::v_cycle(const size_t l)
+{
+    if(l + 1 == levels())
+    {
+        coarse_solve();
+        return;
+    }
+
+    // smooth away the high frequency error, then correct the remaining
+    // smooth error with the coarse level solution of the residual equation
+    smooth(l, pre_smooth, false);
+    residual(l);
+    restrict_to(res[l], f[l + 1], l);
+    zero_grid(u[l + 1]);
+    v_cycle(l + 1);
+    prolong_add(u[l + 1], u[l], l);
+    smooth(l, post_smooth, true);
+}
+
+void PoissonMultigrid::coarse_solve()
+{
+    size_t l = levels() - 1;
+    MyVector<double> b(coarse_map.size());
+    int i, j = 0;
+    for(size_t k = 0; k < coarse_map.size(); k++)
+    {
+        coarse_map.pixel(k, i, j);
+        b[k] = f[l](i + 1, j + 1);
+    }
+    b = coarse_solver.solve(b);
+    for(size_t k = 0; k < coarse_map.size(); k++)
+    {
+        coarse_map.pixel(k, i, j);
+        u[l](i + 1, j + 1) = b[k];
+    }
+}
+
+void PoissonMultigrid::load_rhs(const MyVector<double> &b)
+{
+    if(b.size() != index_map.size())
+        throw std::invalid_argument("b not valid size for multigrid to solve Ax = b");
+
+    for(size_t l = 0; l < levels(); l++)
+    {
+        zero_grid(u[l]);
+        zero_grid(f[l]);
+    }
+    int i, j = 0;
+    for(size_t k = 0; k < b.size(); k++)
+    {
+        index_map.pixel(k, i, j);
+        f[0](i + 1, j + 1) = b[k];
+    }
+}
+
+MyVector<double> PoissonMultigrid::gather_solution() const
+{
+    MyVector<double> x(index_map.size());
+    int i, j = 0;
+    for(size_t k = 0; k < x.size(); k++)
+    {
+        index_map.pixel(k, i, j);
+        x[k] = u[0](i + 1, j + 1);
+    }
+    return x;
+}
+
+void PoissonMultigrid::iterate(const double f_norm, const double tol,
+    const size_t max_cycles)
+{
+    if(f_norm == 0 || history.final_residual() <= tol * f_norm)
+    {
+        history.set_converged(true);
+        return;
+    }
+
+    for(size_t cycle = 0; cycle < max_cycles; cycle++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        v_cycle(0);
+        double r_norm = residual(0);
+        auto stop = std::chrono::steady_clock::now();
+        history.record(r_norm, std::chrono::duration<double>(stop - start).count());
+        if(r_norm <= tol * f_norm)
+        {
+            history.set_converged(true);
+            return;
+        }
+    }
+}
+
+MyVector<double> PoissonMultigrid::operator()(const MyVector<double> &b,
+    const double tol, const size_t max_cycles)
+{
+    if(tol <= 0)
+        throw std::invalid_argument("invalid tolerance for poissonmultigrid()");
+
+    load_rhs(b);
+    double f_norm = std::sqrt(b * b);
+    history.clear(f_norm);
+    iterate(f_norm, tol, max_cycles);
+    return gather_solution();
+}
+
+MyVector<double> PoissonMultigrid::full_multigrid(const MyVector<double> &b,
+    const double tol, const size_t max_cycles)
+{
+    if(tol <= 0)
+        throw std::invalid_argument("invalid tolerance for full_multigrid()");
+
+    load_rhs(b);
+    double f_norm = std::sqrt(b * b);
+    history.clear(f_norm);
+
+    // solve on the coarsest grid first, every finer level starts from the
+    // interpolated coarser solution and needs only one v-cycle to reach
+    // discretization accuracy
+    auto start = std::chrono::steady_clock::now();
+    for(size_t l = 0; l + 1 < levels(); l++)
+        restrict_to(f[l], f[l + 1], l);
+    coarse_solve();
+    for(size_t l = levels() - 1; l-- > 0; )
+    {
+        prolong_add(u[l + 1], u[l], l);
+        v_cycle(l);
+    }
+    double r_norm = residual(0);
+    auto stop = std::chrono::steady_clock::now();
+    history.record(r_norm, std::chrono::duration<double>(stop - start).count());
+
+    iterate(f_norm, tol, max_cycles);
+    return gather_solution();
+}
+
+void swap(PoissonMultigrid &a, PoissonMultigrid &b)
+{
+    swap(a.index_map, b.index_map);
+    std::swap(a.active, b.active);
+    std::swap(a.u, b.u);
+    std::swap(a.f, b.f);
+    std::swap(a.res, b.res);
+    std::swap(a.stencil, b.stencil);
+    swap(a.coarse_map, b.coarse_map);
+    swap(a.coarse_solver, b.coarse_solver);
+    std::swap(a.pre_smooth, b.pre_smooth);
+    std::swap(a.post_smooth, b.post_smooth);
+    std::swap(a.w, b.w);
+    std::swap(a.history, b.history);
+}
@@ -0,0 +1,221 @@
+#ifndef POISSON_STENCIL_H
+#define POISSON_STENCIL_H
+
+#include "../containers/MyVector.h"
+#include "PoissonIndexMap.h"
+
+/*!
+ * @brief poisson stencil class, matrix-free poisson operator of a b/w grid
+ */
+class PoissonStencil;
+
+/*!
+ * @brief swap function, swaps contents of a and b
+ * @pre none
+ * @param[in,out] a lhs of PoissonStencil swap
+ * @param[in,out] b rhs of PoissonStencil swap
+ * @post swaps the contents of PoissonStencil objects a and b
+ */
+void swap(PoissonStencil &a, PoissonStencil &b);
+
+/*!
+ * @brief stencil*vector multiplication, applies poisson operator a to b
+ * @pre the cols of a must be equal to the elements in vector b
+ * @param[in] a poisson stencil to be applied to vector b
+ * @param[in] b vector to be multiplied by the poisson operator a
+ * @throw std::invalid_argument if a.cols() != b.size()
+ * @post applies the 5 point stencil at every unknown of a's grid
+ * @returns a new vector containing result of multiplication
+ */
+MyVector<double> operator*(const PoissonStencil &a, const MyVector<double> &b);
+
+/*!
+ * @brief poisson stencil row class, the (at most 5) entries of one row of
+ *        the poisson operator, sorted by column like a MySparseRow
+ */
+class PoissonStencilRow
+{
+    private:
+        size_t m_cols[5]; //! column index of each entry
+        double m_vals[5]; //! value of each entry
+        size_t m_nnz; //! amount of entries in the row
+
+    public:
+        /*!
+         * @brief param. constructor, row of unknown k given its neighbors
+         * @pre none
+         * @param[in] k unknown of the row, the diagonal entry
+         * @param[in] neighbors unknowns of the pixels below, left, right and
+         *            above the pixel of k (in that order), -1 if none
+         * @post creates the row: 1 at column k, -0.25 at each neighbor
+         */
+        PoissonStencilRow(const size_t k, const int neighbors[4]);
+
+        /*!
+         * @brief size function, returns the amount of entries in the row
+         * @pre none
+         * @post returns the amount of nonzeros in the row
+         * @returns the amount of nonzeros in the row
+         */
+        size_t size() const { return m_nnz; }
+
+        /*!
+         * @brief col function, returns column index of entry e
+         * @pre e must be in range 0 <= e < size()
+         * @param[in] e index of the entry
+         * @post returns the column of entry e
+         * @returns the column of entry e
+         */
+        size_t col(const size_t e) const { return m_cols[e]; }
+
+        /*!
+         * @brief value function, returns value of entry e
+         * @pre e must be in range 0 <= e < size()
+         * @param[in] e index of the entry
+         * @post returns the value of entry e
+         * @returns the value of entry e
+         */
+        double value(const size_t e) const { return m_vals[e]; }
+
+        /*!
+         * @brief subscript operator, returns value of the row at column j
+         * @pre none
+         * @param[in] j column of the row to look up
+         * @post searches the (at most 5) entries for column j
+         * @returns the value at column j, or zero if not a neighbor
+         */
+        double operator[](const size_t j) const;
+
+        /*!
+         * @brief dot function, computes the dot product of the row with x
+         * @pre x must have at least as many elements as the operator has cols
+         * @param[in] x vector to compute dot product with
+         * @post adds products of every entry with matching x element
+         * @returns the dot product of the row and x
+         */
+        double dot(const MyVector<double> &x) const;
+};
+
+/*!
+ * @brief poisson stencil class, matrix-free poisson operator of a b/w grid;
+ *        stands in for the assembled poisson matrix anywhere a solver only
+ *        needs rows()/cols(), row access and multiplication, applying the
+ *        0.25 weighted 5 point stencil straight from the unknown numbering
+ */
+class PoissonStencil
+{
+    private:
+        PoissonIndexMap index_map; //! numbering of unknowns of the b/w grid
+
+    public:
+        typedef PoissonStencilRow row_type; //! type of a row of the operator
+        typedef PoissonStencilRow const_row_type; //! read-only row type
+
+        /*!
+         * @brief default constructor, operator of an empty grid
+         * @pre none
+         * @post creates poissonstencil object of size 0
+         */
+        PoissonStencil(): index_map() {}
+
+        /*!
+         * @brief param. constructor, operator of b/w grid bwm_sep
+         * @pre none
+         * @param[in] bwm_sep vector of strings, one per line of the b/w grid
+         * @post numbers the unknowns of bwm_sep, nothing is assembled
+         */
+        explicit PoissonStencil(const MyVector<string> &bwm_sep):
+            index_map(bwm_sep) {}
+
+        /*!
+         * @brief param. constructor, operator of b/w mask mask
+         * @pre none
+         * @param[in] mask b/w grid, a set bit for every 'B' pixel
+         * @post numbers the unknowns of mask, nothing is assembled
+         */
+        explicit PoissonStencil(const MyBitMask &mask): index_map(mask) {}
+
+        /*!
+         * @brief param. constructor, operator of an already numbered grid
+         * @pre none
+         * @param[in] pim numbering of the unknowns of the b/w grid
+         * @post creates the operator of the grid numbered by pim
+         */
+        explicit PoissonStencil(const PoissonIndexMap &pim): index_map(pim) {}
+
+        /*!
+         * @brief copy constructor, given existing poissonstencil object
+         * @pre none
+         * @param[in] ps existing poissonstencil object to copy
+         * @post creates poissonstencil object identical to ps
+         */
+        PoissonStencil(const PoissonStencil &ps): index_map(ps.index_map) {}
+
+        /*!
+         * @brief assignment operator, assigns calling object equal to ps
+         * @pre none
+         * @param[in] ps copy of poissonstencil object to swap with
+         * @post swaps contents of calling object and the copy ps
+         * @returns the modified calling object after swap
+         */
+        PoissonStencil& operator=(PoissonStencil ps);
+
+        /*!
+         * @brief rows function, returns the amount of rows of the operator
+         * @pre none
+         * @post gets the amount of unknowns of the grid
+         * @returns the amount of rows of the operator
+         */
+        size_t rows() const { return index_map.size(); }
+
+        /*!
+         * @brief cols function, returns the amount of cols of the operator
+         * @pre none
+         * @post gets the amount of unknowns of the grid
+         * @returns the amount of cols of the operator
+         */
+        size_t cols() const { return index_map.size(); }
+
+        /*!
+         * @brief row access function, returns row i of the operator
+         * @pre i must be in range 0 <= i < rows()
+         * @param[in] i the index of the row to access
+         * @throw std::out_of_range if i >= rows()
+         * @post looks up the (at most 4) neighbors of unknown i in O(1)
+         * @returns the entries of row i, sorted by column
+         */
+        PoissonStencilRow operator[](const size_t i) const;
+
+        /*!
+         * @brief evaluation operator, returns entry (i, j) of the operator
+         * @pre i must be in range of the operator
+         * @param[in] i the index of the row to access
+         * @param[in] j the index of the col to access
+         * @throw std::out_of_range if i >= rows()
+         * @post looks up the entry at (i, j)
+         * @returns 1 on the diagonal, -0.25 for neighbors, otherwise zero
+         */
+        double operator()(const size_t i, const size_t j) const
+            { return operator[](i)[j]; }
+
+        /*!
+         * @brief index map function, returns numbering of the unknowns
+         * @pre none
+         * @post gets the numbering of the unknowns of the grid
+         * @returns the pixel/unknown numbering the operator is applied with
+         */
+        const PoissonIndexMap& get_index_map() const { return index_map; }
+
+        /*!
+         * @brief swap function, swaps contents of a and b
+         * @pre none
+         * @param[in,out] a lhs of PoissonStencil swap
+         * @param[in,out] b rhs of PoissonStencil swap
+         * @post swaps the contents of PoissonStencil objects a and b
+         */
+        friend void swap(PoissonStencil &a, PoissonStencil &b);
+};
+
+#include "PoissonStencil.hpp"
+
+#endif
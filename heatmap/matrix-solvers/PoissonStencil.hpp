@@ -0,0 +1,75 @@
+PoissonStencilRow::PoissonStencilRow(const size_t k, const int neighbors[4])
+{
+    // unknowns are numbered bottom row first, left to right, so below and
+    // left come before k and right and above after it
+    m_nnz = 0;
+    for(size_t e = 0; e < 2; e++)
+    {
+        if(neighbors[e] < 0)
+            continue;
+        m_cols[m_nnz] = neighbors[e];
+        m_vals[m_nnz++] = -0.25;
+    }
+    m_cols[m_nnz] = k;
+    m_vals[m_nnz++] = 1;
+    for(size_t e = 2; e < 4; e++)
+    {
+        if(neighbors[e] < 0)
+            continue;
+        m_cols[m_nnz] = neighbors[e];
+        m_vals[m_nnz++] = -0.25;
+    }
+}
+
+double PoissonStencilRow::operator[](const size_t j) const
+{
+    for(size_t e = 0; e < m_nnz; e++)
+        if(m_cols[e] == j)
+            return m_vals[e];
+    return 0;
+}
+
+double PoissonStencilRow::dot(const MyVector<double> &x) const
+{
+    const double *x_data = x.data();
+    double sum = 0;
+    for(size_t e = 0; e < m_nnz; e++)
+        sum += m_vals[e] * x_data[m_cols[e]];
+    return sum;
+}
+
+PoissonStencil& PoissonStencil::operator=(PoissonStencil ps)
+{
+    swap(*this, ps);
+    return *this;
+}
+
+PoissonStencilRow PoissonStencil::operator[](const size_t i) const
+{
+    int pi, pj = 0;
+    index_map.pixel(i, pi, pj);
+    const int neighbors[4] = {
+        index_map(pi + 1, pj),
+        index_map(pi, pj - 1),
+        index_map(pi, pj + 1),
+        index_map(pi - 1, pj)
+    };
+    return PoissonStencilRow(i, neighbors);
+}
+
+void swap(PoissonStencil &a, PoissonStencil &b)
+{
+    swap(a.index_map, b.index_map);
+}
+
+MyVector<double> operator*(const PoissonStencil &a, const MyVector<double> &b)
+{
+    if(a.cols() != b.size())
+        throw std::invalid_argument("cant mult. stencil/vect, incompat. sizes");
+
+    MyVector<double> product(a.rows());
+    double *p_data = product.data();
+    for(size_t i = 0; i < a.rows(); i++)
+        p_data[i] = a[i].dot(b);
+    return product;
+}
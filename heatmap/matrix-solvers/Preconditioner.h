@@ -0,0 +1,44 @@
+#ifndef PRECONDITIONER_H
+#define PRECONDITIONER_H
+
+#include "../containers/MyVector.h"
+
+/*! preconditioner base class, provides the interface for all preconditioners
+ * @brief preconditioner base class, applies an approximate inverse of A to a
+ *        residual; the base class itself is the identity (no preconditioning)
+ */
+class Preconditioner
+{
+    public:
+        /*! virtual destructor, allows deleting children through base pointer
+         * @brief virtual destructor, allows deleting children through base ptr
+         * @pre none
+         * @post destroys the preconditioner object
+         */
+        virtual ~Preconditioner() {}
+
+        /*! virtual apply function, solves Mz = r for z
+         * @brief virtual apply function, solves Mz = r for z
+         * @pre r and z must have the same size as the preconditioned matrix
+         * @param[in] r residual vector to precondition
+         * @param[out] z preconditioned residual, M^-1 r
+         * @post writes M^-1 r to z, the base class copies r to z unchanged
+         */
+        virtual void apply(const MyVector<double> &r, MyVector<double> &z) const
+        {
+            const double *r_data = r.data();
+            double *z_data = z.data();
+            for(size_t i = 0; i < r.size(); i++)
+                z_data[i] = r_data[i];
+        }
+
+        /*! virtual name function, returns name of the preconditioner
+         * @brief virtual name function, returns name of the preconditioner
+         * @pre none
+         * @post gets a short name describing the preconditioner
+         * @returns the name of the preconditioner
+         */
+        virtual const char* name() const { return "none"; }
+};
+
+#endif
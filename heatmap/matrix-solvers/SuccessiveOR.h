@@ -2,12 +2,31 @@
 #define SUCCESSIVE_OR_H
 
 #include "../containers/MyMatrix.h"
+#include "../containers/MySparseMatrix.h"
+#include "ThreadBarrier.h"
+#include "ConvergenceHistory.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <thread>
+#include <vector>
 using std::min;
 
+/*! default amount of sweeps a successive or solve may take before giving up
+ */
+const size_t SOR_MAX_ITERATIONS = 100000;
+
+/*! change of the sweep convergence rate between two sweeps, relative to
+ *  one minus the rate, below which adaptive successive or trusts the rate
+ *  enough to re-estimate omega
+ */
+const double SOR_RATE_SETTLED = 1e-2;
+
 /*!
  * @brief successiveor class, a functor to wrap around  successive 
  *        over-relaxation method
  */
+template <typename Operator = MySparseMatrix<double>>
 class SuccessiveOR;
 
 /*!
@@ -28,41 +47,97 @@ double get_w_value() { return 1.6; }
  * @param[in,out] b lhs of SuccessiveOR swap
  * @post swaps the contents of SuccessiveOR objects a and b
  */
-void swap(SuccessiveOR &a, SuccessiveOR &b);
+template <typename Operator>
+void swap(SuccessiveOR<Operator> &a, SuccessiveOR<Operator> &b);
 
 /*!
  * @brief successiveor class, a functor to wrap around  successive 
- *        over-relaxation method
+ *        over-relaxation method; Operator is the type of A, the assembled
+ *        MySparseMatrix by default or any type with the same rows(), row
+ *        access (size/col/value/dot) and (i, j) lookup, e.g. the matrix-free
+ *        PoissonStencil
  */
+template <typename Operator>
 class SuccessiveOR
 {
     private:
-        MyMatrix<double> A; //! matrix A to solve equation Ax = b
+        Operator A; //! operator A to solve equation Ax = b
         int n; //! amount of rows/columns in matrix A
-    
+        MyVector<size_t> color_order; //! unknowns grouped by color
+        MyVector<size_t> color_start; //! offset of each color in color_order
+        ConvergenceHistory history; //! residuals and timings of last solve
+        double omega; //! relaxation parameter the last solve finished with
+
+        /*!
+         * @brief helper function, colors the unknowns of A for parallel sweeps
+         * @pre A must be square
+         * @post greedily (in breadth first order) gives every unknown the
+         *       smallest color not used by a coupled unknown, so unknowns of
+         *       one color never depend on each other; the poisson grid gets
+         *       the two red-black colors
+         */
+        void color_unknowns();
+
+        /*!
+         * @brief helper function, returns the diagonal of A
+         * @pre none
+         * @post looks up the diagonal entry of every row once
+         * @returns vector of the n diagonal entries of A
+         */
+        MyVector<double> diagonal() const;
+
+        /*!
+         * @brief helper function, one lexicographic sweep over every unknown
+         * @pre b, diag and x must be the same size as A
+         * @param[in] b rhs of linear system Ax = b
+         * @param[in] diag diagonal of A, so the sweep can sum the whole row
+         *            branch free
+         * @param[in,out] x current iterate, updated in place
+         * @param[in] w relaxation parameter of the sweep
+         * @param[out] change_norm 2-norm of the change to x over the sweep
+         * @param[out] res_norm 2-norm of the residual of every row, taken
+         *             just before the row is updated
+         * @post relaxes every unknown once, in natural order
+         * @returns the largest change of a single unknown over the sweep
+         */
+        double sweep(const MyVector<double> &b, const MyVector<double> &diag,
+            MyVector<double> &x, const double w, double &change_norm,
+            double &res_norm) const;
+
     public:
         /*!
          * @brief default constructor, initialize empty A matrix of size 0
          * @pre none
          * @post creates a successiveor object with empty member vars.
          */
-        SuccessiveOR(): A(MyMatrix<double>()), n(0) {}
+        SuccessiveOR(): A(), n(0), color_order(), color_start(1), history(),
+            omega(0) { color_start[0] = 0; }
 
         /*!
          * @brief param. constructor, given existing nxn matrix m
          * @pre matrix m must be symmetric, positive-definite banded matrix
          * @param[in] m matrix to be used in successive or algorithm
-         * @post creates successiveor object to use on matrix A
+         * @post creates successiveor object to use on matrix A, storing only
+         *       the nonzero entries of m; requires Operator to be
+         *       constructible from a MyMatrix
          */
         explicit SuccessiveOR(const MyMatrix<double> &m);
 
+        /*!
+         * @brief param. constructor, given existing nxn operator m
+         * @pre operator m must be symmetric, positive-definite and banded
+         * @param[in] m sparse matrix (or stencil) to be used in successive or
+         * @post creates successiveor object to use on operator A
+         */
+        explicit SuccessiveOR(const Operator &m);
+
         /*!
          * @brief copy constructor, given existing successive or
          * @pre none
          * @param[in] bg existing successiveor object to copy
          * @post creates successiveor object identical to bg
          */
-        SuccessiveOR(const SuccessiveOR &bg);
+        SuccessiveOR(const SuccessiveOR<Operator> &bg);
 
         /*!
          * @brief assignment operator, assigns calling object equal to bg
@@ -71,7 +146,7 @@ class SuccessiveOR
          * @post copies contents of bg to calling object
          * @returns the modified calling object after assignment
          */
-        SuccessiveOR& operator=(SuccessiveOR &bg);
+        SuccessiveOR<Operator>& operator=(SuccessiveOR<Operator> &bg);
 
         /*!
          * @brief eval operator, solves matrix Ax = b efficiently via successive
@@ -80,31 +155,103 @@ class SuccessiveOR
          * @param[in] b rhs of linear system Ax = b
          * @param[in] w relaxation parameter, weight of previous/next iteration
          * @param[in] es acceptable error threshold, algorithm stopping condition
+         * @param[in] max_iter most sweeps to perform before giving up
          * @throw std::invalid_argument if w not in (1, 2), es not positive, b wrong size
-         * @post performs successive over-relaxation to solve Ax = b
-         * @returns solution vector x after linear system sufficiently solved
+         * @post performs successive over-relaxation to solve Ax = b, until no
+         *       unknown changes by more than es or max_iter sweeps ran,
+         *       recording every sweep's residual norm in history
+         * @returns solution vector x after the last sweep
+         */
+        MyVector<double> operator()(const MyVector<double> &b, const double w,
+            const double es, const size_t max_iter = SOR_MAX_ITERATIONS);
+
+        /*!
+         * @brief adaptive solve, solves Ax = b via successive over-relaxation,
+         *        estimating the optimal relaxation parameter while it runs
+         * @pre es must be positive, b must be same size as A, A must be
+         *      consistently ordered (such as the poisson matrix)
+         * @param[in] b rhs of linear system Ax = b
+         * @param[in] es acceptable error threshold, algorithm stopping condition
+         * @param[in] max_iter most sweeps to perform before giving up
+         * @throw std::invalid_argument if es not positive or b wrong size
+         * @post starts from gauss-seidel (w = 1); whenever the ratio of the
+         *       norms of two successive changes to x has settled, it is taken
+         *       as the spectral radius of the current sweep, from which the
+         *       spectral radius mu of jacobi and the optimal w =
+         *       2 / (1 + sqrt(1 - mu^2)) follow; w only ever increases, and
+         *       the final w is kept for get_omega()
+         * @returns solution vector x after the last sweep
+         */
+        MyVector<double> solve_adaptive(const MyVector<double> &b,
+            const double es, const size_t max_iter = SOR_MAX_ITERATIONS);
+
+        /*!
+         * @brief red-black solve, solves Ax = b via multicolor ordered
+         *        successive over-relaxation, sweeping each color in parallel
+         * @pre w must be in (1, 2), es must be positive, b must be same size as
+         *      A, num_threads must be positive
+         * @param[in] b rhs of linear system Ax = b
+         * @param[in] w relaxation parameter, weight of previous/next iteration
+         * @param[in] es acceptable error threshold, algorithm stopping condition
+         * @param[in] num_threads amount of threads to split each color over
+         * @param[in] max_iter most sweeps to perform before giving up
+         * @throw std::invalid_argument if w not in (1, 2), es not positive, b
+         *        wrong size or num_threads is zero
+         * @post updates all unknowns of one color, then the next, splitting
+         *       every color across num_threads threads; converges to the same
+         *       solution as operator() within the error threshold es, and
+         *       records every sweep's residual norm in history
+         * @returns solution vector x after the last sweep
+         */
+        MyVector<double> solve_red_black(const MyVector<double> &b,
+            const double w, const double es, const size_t num_threads,
+            const size_t max_iter = SOR_MAX_ITERATIONS);
+
+        /*!
+         * @brief history function, returns the record of the last solve
+         * @pre none
+         * @post gets sweep count, residual norms and timings of last solve
+         * @returns the convergence history of the last solve
+         */
+        const ConvergenceHistory& get_history() const { return history; }
+
+        /*!
+         * @brief omega function, returns relaxation param. of the last solve
+         * @pre none
+         * @post gets the w the last solve finished with, the estimated
+         *       optimal w after solve_adaptive()
+         * @returns the relaxation parameter of the last solve, 0 if none ran
+         */
+        double get_omega() const { return omega; }
+
+        /*!
+         * @brief colors function, returns amount of colors of the unknowns
+         * @pre none
+         * @post gets the amount of independent sets solve_red_black sweeps
+         * @returns the amount of colors, 2 for the poisson grid
          */
-        MyVector<double> operator()(const MyVector<double> &b, const double w, const double es);
+        size_t colors() const { return color_start.size() - 1; }
 
         /*!
-         * @brief access operator, return value of vector at matrix index i
+         * @brief access operator, return view of row at matrix index i
          * @pre i must be in range of matrix A
          * @param[in] i matrix index to access
          * @throw std::out_of_range if i out of range of matrix A
-         * @post return copy of matrix vector at index i
-         * @returns the accessed matrix vector at index i
+         * @post return read-only view of stored entries of matrix row i
+         * @returns read-only view of the accessed operator row at index i
          */
-        MyVector<double> operator[](const size_t i) const;
+        typename Operator::const_row_type operator[](const size_t i) const;
 
         /*!
-         * @brief access operator, return reference to vector at matrix index i
+         * @brief access operator, return view of row at matrix index i
          * @pre i must be in range of matrix A
          * @param[in] i matrix index to access
          * @throw std::out_of_range if i out of range of matrix A
-         * @post access matrix vector at index i of A
-         * @returns reference to accessed matrix vector at index i
+         * @post access stored entries of matrix row at index i of A
+         * @returns view of accessed operator row i, values are mutable if
+         *          the operator stores them
          */
-        MyVector<double>& operator[](const size_t i);
+        typename Operator::row_type operator[](const size_t i);
 
         /*!
          * @brief size function, returns size of member obj. matrix A
@@ -121,7 +268,7 @@ class SuccessiveOR
          * @param[in,out] b lhs of SuccessiveOR swap
          * @post swaps the contents of SuccessiveOR objects a and b
          */
-        friend void swap(SuccessiveOR &a, SuccessiveOR &b);
+        friend void swap<Operator>(SuccessiveOR<Operator> &a, SuccessiveOR<Operator> &b);
 };
 
 #include "SuccessiveOR.hpp"
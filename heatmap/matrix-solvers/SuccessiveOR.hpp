@@ -1,23 +1,148 @@
-SuccessiveOR::SuccessiveOR(const MyMatrix<double> &m)
+template <typename Operator>
+SuccessiveOR<Operator>::SuccessiveOR(const MyMatrix<double> &m)
+{
+    A = Operator(m);
+    n = A.rows();
+    omega = 0;
+    color_unknowns();
+}
+
+template <typename Operator>
+SuccessiveOR<Operator>::SuccessiveOR(const Operator &m)
 {
-    A.resize(m.rows(), m.cols());
     A = m;
     n = A.rows();
+    omega = 0;
+    color_unknowns();
 }
 
-SuccessiveOR::SuccessiveOR(const SuccessiveOR &bg)
+template <typename Operator>
+SuccessiveOR<Operator>::SuccessiveOR(const SuccessiveOR<Operator> &bg)
 {
     A = bg.A;
     n = bg.size();
+    color_order = bg.color_order;
+    color_start = bg.color_start;
+    history = bg.history;
+    omega = bg.omega;
 }
 
-SuccessiveOR& SuccessiveOR::operator=(SuccessiveOR &bg)
+template <typename Operator>
+void SuccessiveOR<Operator>::color_unknowns()
+{
+    // visit the unknowns breadth first, so on a bipartite graph (such as the
+    // 5 point poisson grid) every coupled unknown already colored sits one
+    // level closer to the start and greedy coloring finds the two colors
+    MyVector<size_t> bfs_order(n);
+    std::vector<bool> visited(n, false);
+    size_t head = 0;
+    size_t tail = 0;
+    for(int start = 0; start < n; start++)
+    {
+        if(visited[start])
+            continue;
+        visited[start] = true;
+        bfs_order[tail++] = start;
+        while(head < tail)
+        {
+            typename Operator::const_row_type row = A[bfs_order[head++]];
+            for(size_t k = 0; k < row.size(); k++)
+            {
+                if(!visited[row.col(k)])
+                {
+                    visited[row.col(k)] = true;
+                    bfs_order[tail++] = row.col(k);
+                }
+            }
+        }
+    }
+
+    // give every unknown the smallest color no colored coupled unknown has
+    const size_t uncolored = size_t(n);
+    MyVector<size_t> color(n);
+    std::fill(color.begin(), color.end(), uncolored);
+    MyVector<size_t> count(1);
+    count[0] = 0;
+    std::vector<bool> used;
+    for(int e = 0; e < n; e++)
+    {
+        size_t i = bfs_order[e];
+        typename Operator::const_row_type row = A[i];
+        used.assign(count.size() + 1, false);
+        for(size_t k = 0; k < row.size(); k++)
+            if(row.col(k) != i && color[row.col(k)] != uncolored)
+                used[color[row.col(k)]] = true;
+
+        size_t c = 0;
+        while(used[c])
+            c++;
+        if(c == count.size())
+            count.push_back(0);
+        color[i] = c;
+        count[c]++;
+    }
+
+    // bucket the unknowns by color, keeping natural order within a color
+    color_start = MyVector<size_t>(count.size() + 1);
+    color_start[0] = 0;
+    for(size_t c = 0; c < count.size(); c++)
+        color_start[c + 1] = color_start[c] + count[c];
+    color_order = MyVector<size_t>(n);
+    MyVector<size_t> next(color_start);
+    for(int i = 0; i < n; i++)
+        color_order[next[color[i]]++] = i;
+}
+
+template <typename Operator>
+SuccessiveOR<Operator>& SuccessiveOR<Operator>::operator=(SuccessiveOR<Operator> &bg)
 {
     swap(bg, *this);
     return *this;
 }
 
-MyVector<double> SuccessiveOR::operator()(const MyVector<double> &b, const double w, const double es)
+template <typename Operator>
+MyVector<double> SuccessiveOR<Operator>::diagonal() const
+{
+    MyVector<double> diag(n);
+    for(int i = 0; i < n; i++)
+        diag[i] = A(i, i);
+    return diag;
+}
+
+template <typename Operator>
+double SuccessiveOR<Operator>::sweep(const MyVector<double> &b,
+    const MyVector<double> &diag, MyVector<double> &x, const double w,
+    double &change_norm, double &res_norm) const
+{
+    double ea = 0;
+    change_norm = 0;
+    res_norm = 0;
+
+    // sizes were checked by the callers, so the loop indexes raw storage
+    const double *b_data = b.data();
+    const double *diag_data = diag.data();
+    double *x_data = x.data();
+    for(int i = 0; i < n; i++)
+    {
+        // only the stored nonzeros of row i contribute to the sum, the
+        // diagonal term is taken back out rather than skipped in the loop
+        double x_old = x_data[i];
+        double sum = A[i].dot(x) - diag_data[i] * x_old;
+        double res = b_data[i] - sum - diag_data[i] * x_old;
+        x_data[i] = x_old + w * (((b_data[i] - sum) / diag_data[i]) - x_old);
+        double curr_error = std::abs(x_old - x_data[i]);
+        if(curr_error > ea) ea = curr_error;
+        change_norm += curr_error * curr_error;
+        res_norm += res * res;
+    }
+    change_norm = std::sqrt(change_norm);
+    res_norm = std::sqrt(res_norm);
+    return ea;
+}
+
+template <typename Operator>
+MyVector<double> SuccessiveOR<Operator>::operator()(const MyVector<double> &b,
+    const double w, const double es, const size_t max_iter)
 {
     if(b.size() != A.rows())
         throw std::invalid_argument("b not valid size for SOR to solve Ax = b");
@@ -27,43 +152,214 @@ MyVector<double> SuccessiveOR::operator()(const MyVector<double> &b, const doubl
         throw std::invalid_argument("invalid error threshold for succesiveor()");
 
     MyVector<double> x(b.size());
-    x = x * double(0);
+    x *= double(0);
+    omega = w;
+    history.clear(std::sqrt(b * b));
+    const MyVector<double> diag = diagonal();
 
-    double ea = 0;
-    do
+    for(size_t iter = 0; iter < max_iter; iter++)
     {
-        ea = 0;
-        for(int i = 0; i < n; i++)
+        auto start = std::chrono::steady_clock::now();
+        double change_norm, res_norm;
+        double ea = sweep(b, diag, x, w, change_norm, res_norm);
+        auto stop = std::chrono::steady_clock::now();
+        history.record(res_norm, std::chrono::duration<double>(stop - start).count());
+        if(ea <= es)
         {
-            double sum = 0;
-            for(int j = 0; j < n; j++)
-                sum += (i != j) ? A[i][j]*x[j] : 0;
-
-            double x_old = x[i];
-            x[i] = x[i] + w * (((b[i] - sum)/ A[i][i]) - x[i]);
-            double curr_error = std::abs(x_old - x[i]);
-            if(curr_error > ea) ea = curr_error;
+            history.set_converged(true);
+            break;
         }
-    } while(ea > es);
+    }
+    return x;
+}
+
+template <typename Operator>
+MyVector<double> SuccessiveOR<Operator>::solve_adaptive(const MyVector<double> &b,
+    const double es, const size_t max_iter)
+{
+    if(b.size() != A.rows())
+        throw std::invalid_argument("b not valid size for SOR to solve Ax = b");
+    if(es <= 0)
+        throw std::invalid_argument("invalid error threshold for succesiveor()");
+
+    MyVector<double> x(b.size());
+    x *= double(0);
+    history.clear(std::sqrt(b * b));
+    const MyVector<double> diag = diagonal();
+
+    double w = 1;
+    double prev_change = 0;
+    double prev_rate = 0;
+    for(size_t iter = 0; iter < max_iter; iter++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        double change_norm, res_norm;
+        double ea = sweep(b, diag, x, w, change_norm, res_norm);
+        auto stop = std::chrono::steady_clock::now();
+        history.record(res_norm, std::chrono::duration<double>(stop - start).count());
+        if(ea <= es)
+        {
+            history.set_converged(true);
+            break;
+        }
+
+        // once the change shrinks by a steady factor, that factor is the
+        // spectral radius lambda of the current sweep; for a consistently
+        // ordered matrix and w below the optimum, lambda > w - 1 relates to
+        // the spectral radius mu of jacobi by (lambda + w - 1)^2 =
+        // lambda w^2 mu^2, while at or past the optimum lambda is w - 1 and
+        // says nothing more about mu; steadiness is judged relative to
+        // 1 - lambda, since rates close to one drift by tiny amounts
+        double rate = (prev_change > 0) ? change_norm / prev_change : 0;
+        if(rate > w - 1 && rate < 1 &&
+            std::abs(rate - prev_rate) <= SOR_RATE_SETTLED * (1 - rate))
+        {
+            double mu = (rate + w - 1) / (w * std::sqrt(rate));
+            if(mu < 1)
+            {
+                double w_opt = 2 / (1 + std::sqrt(1 - mu * mu));
+                if(w_opt > w)
+                {
+                    // the next few rates mix both w values, wait for them
+                    // to settle again before trusting another estimate
+                    w = w_opt;
+                    rate = 0;
+                }
+            }
+        }
+        prev_rate = rate;
+        prev_change = change_norm;
+    }
+    omega = w;
+    return x;
+}
+
+template <typename Operator>
+MyVector<double> SuccessiveOR<Operator>::solve_red_black(const MyVector<double> &b,
+    const double w, const double es, const size_t num_threads,
+    const size_t max_iter)
+{
+    if(b.size() != A.rows())
+        throw std::invalid_argument("b not valid size for SOR to solve Ax = b");
+    if(w <= 1 || w >= 2)
+        throw std::invalid_argument("omega invalid for successiveor()");
+    if(es <= 0)
+        throw std::invalid_argument("invalid error threshold for succesiveor()");
+    if(num_threads == 0)
+        throw std::invalid_argument("red-black successiveor needs a thread");
+
+    MyVector<double> x(b.size());
+    x *= double(0);
+    omega = w;
+    history.clear(std::sqrt(b * b));
+
+    // diagonal of every row, so the sweep can sum the whole row branch free
+    const MyVector<double> diag = diagonal();
+
+    // more threads than unknowns per color would only wait on each other
+    size_t threads = std::min(num_threads,
+        std::max(size_t(n) / colors(), size_t(1)));
+
+    // error and squared residual of each thread, double buffered by
+    // iteration parity so a thread can write the next iteration's values
+    // while others read this one's
+    std::vector<double> thread_error(2 * threads, 0);
+    std::vector<double> thread_res(2 * threads, 0);
+    ThreadBarrier barrier(threads);
+
+    const double *b_data = b.data();
+    const double *diag_data = diag.data();
+    double *x_data = x.data();
+
+    auto sweep = [&](const size_t t)
+    {
+        for(size_t iter = 0; iter < max_iter; iter++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            double ea = 0;
+            double res_sq = 0;
+            for(size_t c = 0; c < colors(); c++)
+            {
+                // unknowns of one color are not coupled, so every thread
+                // updates its share of the color without any locking
+                size_t len = color_start[c + 1] - color_start[c];
+                size_t lo = color_start[c] + len * t / threads;
+                size_t hi = color_start[c] + len * (t + 1) / threads;
+                for(size_t e = lo; e < hi; e++)
+                {
+                    size_t i = color_order[e];
+                    double x_old = x_data[i];
+                    double sum = A[i].dot(x) - diag_data[i] * x_old;
+                    double res = b_data[i] - sum - diag_data[i] * x_old;
+                    x_data[i] = x_old + w * (((b_data[i] - sum) / diag_data[i]) - x_old);
+                    double curr_error = std::abs(x_old - x_data[i]);
+                    if(curr_error > ea) ea = curr_error;
+                    res_sq += res * res;
+                }
+                if(c + 1 < colors())
+                    barrier.wait();
+            }
+
+            double *errors = thread_error.data() + (iter % 2) * threads;
+            double *residuals = thread_res.data() + (iter % 2) * threads;
+            errors[t] = ea;
+            residuals[t] = res_sq;
+            barrier.wait();
+            double max_error = 0;
+            for(size_t s = 0; s < threads; s++)
+                max_error = std::max(max_error, errors[s]);
+
+            // only the first thread writes the history, the others never
+            // touch it until every thread has joined
+            if(t == 0)
+            {
+                double res_norm = 0;
+                for(size_t s = 0; s < threads; s++)
+                    res_norm += residuals[s];
+                auto stop = std::chrono::steady_clock::now();
+                history.record(std::sqrt(res_norm),
+                    std::chrono::duration<double>(stop - start).count());
+                if(max_error <= es)
+                    history.set_converged(true);
+            }
+            if(max_error <= es)
+                return;
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for(size_t t = 1; t < threads; t++)
+        workers.push_back(std::thread(sweep, t));
+    sweep(0);
+    for(size_t t = 0; t < workers.size(); t++)
+        workers[t].join();
+
     return x;
 }
 
-MyVector<double> SuccessiveOR::operator[](const size_t i) const
+template <typename Operator>
+typename Operator::const_row_type SuccessiveOR<Operator>::operator[](const size_t i) const
 {
     if(int(i) < 0 || i >= A.rows())
         throw std::out_of_range("i out of range for successive-or[]");
     return A[i];
 }
 
-MyVector<double>& SuccessiveOR::operator[](const size_t i)
+template <typename Operator>
+typename Operator::row_type SuccessiveOR<Operator>::operator[](const size_t i)
 {
     if(int(i) < 0 || i >= A.rows())
         throw std::out_of_range("i out of range for successive-or[]");
     return A[i];
 }
 
-void swap(SuccessiveOR &a, SuccessiveOR &b)
+template <typename Operator>
+void swap(SuccessiveOR<Operator> &a, SuccessiveOR<Operator> &b)
 {
     swap(a.A, b.A);
     std::swap(a.n, b.n);
+    swap(a.color_order, b.color_order);
+    swap(a.color_start, b.color_start);
+    std::swap(a.history, b.history);
+    std::swap(a.omega, b.omega);
 }
\ No newline at end of file
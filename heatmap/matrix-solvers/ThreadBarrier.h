@@ -0,0 +1,46 @@
+#ifndef THREAD_BARRIER_H
+#define THREAD_BARRIER_H
+
+#include <mutex>
+#include <condition_variable>
+#include <cstddef>
+#include <stdexcept>
+
+/*!
+ * @brief thread barrier class, blocks a fixed group of threads until every
+ *        one of them has reached the barrier, then releases them together
+ */
+class ThreadBarrier
+{
+    private:
+        std::mutex m_mutex; //! guards the waiting count and generation
+        std::condition_variable m_cond; //! waited on until generation changes
+        size_t m_threads; //! amount of threads the barrier waits for
+        size_t m_waiting; //! amount of threads waiting in current generation
+        size_t m_generation; //! bumped every time the barrier opens
+
+    public:
+        /*!
+         * @brief param. constructor, barrier for a group of num_threads
+         * @pre num_threads must be positive
+         * @param[in] num_threads amount of threads that must call wait()
+         * @throw std::invalid_argument if num_threads is zero
+         * @post creates a closed barrier for num_threads threads
+         */
+        explicit ThreadBarrier(const size_t num_threads);
+
+        /*!
+         * @brief wait function, blocks until every thread has called wait()
+         * @pre must be called by exactly as many threads as given on creation
+         * @post blocks the caller until the last thread arrives, then opens
+         *       the barrier; the barrier is reusable right away
+         */
+        void wait();
+
+        ThreadBarrier(const ThreadBarrier &tb) = delete;
+        ThreadBarrier& operator=(const ThreadBarrier &tb) = delete;
+};
+
+#include "ThreadBarrier.hpp"
+
+#endif
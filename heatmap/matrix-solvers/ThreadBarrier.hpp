@@ -0,0 +1,21 @@
+ThreadBarrier::ThreadBarrier(const size_t num_threads): m_threads(num_threads),
+    m_waiting(0), m_generation(0)
+{
+    if(num_threads == 0)
+        throw std::invalid_argument("thread barrier needs at least one thread");
+}
+
+void ThreadBarrier::wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    size_t generation = m_generation;
+    if(++m_waiting == m_threads)
+    {
+        // last thread to arrive opens the barrier for the next round
+        m_waiting = 0;
+        m_generation++;
+        m_cond.notify_all();
+        return;
+    }
+    m_cond.wait(lock, [this, generation] { return generation != m_generation; });
+}
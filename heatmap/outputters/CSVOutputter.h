@@ -2,9 +2,23 @@
 #define CSV_OUTPUTTER_H
 
 #include <fstream>
+#include <cstdio>
+#include <cstring>
 #include "../containers/MyVector.h"
+#include "../containers/MyMatrix.h"
+#include "MappedFile.h"
+#include "../containers/MyBitMask.h"
+#include "../containers/MyBitRank.h"
 using std::string;
 
+/*! longest text "%f" makes of a double, sign, 309 digits, point, 6 decimals */
+const size_t CSV_MAX_VALUE_CHARS = 320;
+
+/*! the NPY format pads its header so the array data starts at a multiple
+ *  of this many bytes
+ */
+const size_t NPY_HEADER_ALIGN = 64;
+
 class CSVOutputter;
 
 /*!
@@ -31,10 +45,28 @@ class CSVOutputter
 {
     private:
         MyVector<double> solution; //! double sol. vector obtained from Chol/SOR method
-        MyVector<string> bwm_sep; //! string vector representing black/white txt file
-        int n; //! size of solution vector, aka number of unknowns solved
-        MyVector<string> ordered_sol; //! ordered solution vector, read to write to csv
+        MyBitRank bwm; //! b/w grid, ranked bottom up like the unknowns are numbered
+        MyMatrix<double> grid; //! solution on the pixels of the b/w grid, 0 off 'B'
         bool is_ordered; // if solution has been ordered, this is true, otherwise false
+
+        /*!
+         * @brief csv row function, formats row i of the grid as one csv line
+         * @pre the solution must have been ordered
+         * @param[in] i index of the row, line of the b/w text file
+         * @param[in,out] line buffer to format into, its old contents are
+         *                dropped but its capacity is reused
+         * @post line holds one field per col of the grid: the value "%f"
+         *       formatted for 'B' pixels, "0" for the rest
+         */
+        void format_csv_row(const size_t i, string &line) const;
+
+        /*!
+         * @brief raw write function, copies the grid into memory at dst
+         * @pre the solution must have been ordered, dst holds grid size
+         * @param[out] dst memory for rows() * cols() doubles
+         * @post writes the grid row after row, without the row padding
+         */
+        void copy_grid(char *dst) const;
     
     public:
         /*!
@@ -42,8 +74,8 @@ class CSVOutputter
          * @pre none
          * @post creates empty csvoutputter with vectors of size zero
          */
-        CSVOutputter(): solution(MyVector<double>()), bwm_sep(MyVector<string>()), n(0),
-            ordered_sol(MyVector<string>()), is_ordered(false) {}
+        CSVOutputter(): solution(MyVector<double>()), bwm(), grid(),
+            is_ordered(false) {}
 
         /*!
          * @brief param. constructor, given b/w txt matrix, solution vect, num (size of vect)
@@ -51,11 +83,25 @@ class CSVOutputter
          * @param[in] bw string vector, containing contents of b/w text file
          * @param[in] solution vector obtained via Chol/SOR method
          * @param[in] num size of s, amount of unknowns previously solved
-         * @throw std::invalid_argument if s.size() != num
-         * @post creates a csvoutputter object given relevent parameters
+         * @throw std::invalid_argument if s.size() != num, or if num is not the
+         *        number of 'B' pixels in bw
+         * @post creates a csvoutputter object given relevent parameters,
+         *       numbering the unknowns of bw itself
          */
         CSVOutputter(const MyVector<string> &bw, const MyVector<double> &s, const int num);
 
+        /*!
+         * @brief param. constructor, given the b/w mask and the solution vect
+         * @pre s must hold one value per set pixel of mask
+         * @param[in] mask b/w grid, a set bit for every 'B' pixel
+         * @param[in] s solution vector obtained via Chol/SOR method
+         * @throw std::invalid_argument if s.size() != mask.count()
+         * @post creates a csvoutputter object keeping the grid as a bit mask
+         *       ranked bottom up, about 1/7 of the memory of one char per
+         *       pixel, and the unknown of any pixel a rank away
+         */
+        CSVOutputter(const MyBitMask &mask, const MyVector<double> &s);
+
         /*!
          * @brief copy constructor, creates csvoutputter object identical to csvo
          * @pre none
@@ -74,13 +120,16 @@ class CSVOutputter
         CSVOutputter& operator=(CSVOutputter csvo);
 
         /*!
-         * @brief eval. operator, calculates the ordered solution vector given the b/w text
-         *        file matrix and the solution obtained from Chol/SOR methods
+         * @brief eval. operator, places the solution obtained from Chol/SOR
+         *        methods on the pixels of the b/w text file matrix
          * @pre none
-         * @post finds the ordered solution vector, given b/w text file and solution vect
-         * @returns a reference to the ordered solution vector
+         * @post fills the grid with the value of each unknown at its pixel and
+         *       zero everywhere else; each row takes one rank for its first
+         *       unknown and then visits only the set bits of its words
+         * @returns a read-only reference to the grid, one row per line of the
+         *          b/w file and as many cols as its longest line
          */
-        MyVector<string>& operator()();
+        const MyMatrix<double>& operator()();
 
         /*!
          * @brief reset function, recreates calling object with new b/w text vector, 
@@ -89,7 +138,8 @@ class CSVOutputter
          * @param[in] bw string vector, containing contents of b/w text file
          * @param[in] solution vector obtained via Chol/SOR method
          * @param[in] num size of s, amount of unknowns previously solved
-         * @throw std::invalid_argument if num != s.size()
+         * @throw std::invalid_argument if num != s.size(), or if num is not
+         *        the number of 'B' pixels in bw
          * @post create calling object with new bw, s, num
          */
         void reset(const MyVector<string> &bw, const MyVector<double> &s, const int num);
@@ -99,10 +149,48 @@ class CSVOutputter
          * @pre csvoutputter sol. vect. must have been previously ordered
          * @param[in] out_file name of the path to create csv file under
          * @throw std::invalid_argument if sol. vect. has not been ordered
-         * @post creates a csv file containing ordered sol. vect.
+         * @post creates a csv file containing ordered sol. vect., formatting
+         *       each line into one reused buffer and writing it in one call,
+         *       so only one formatted line is held at a time
          */
         void output_to_file(const string out_file) const;
 
+        /*!
+         * @brief binary output function, outputs the grid as raw doubles
+         * @pre csvoutputter sol. vect. must have been previously ordered
+         * @param[in] out_file name of the path to create the file under
+         * @throw std::invalid_argument if sol. vect. has not been ordered, or
+         *        if out_file cannot be created
+         * @post creates a file of rows() * cols() native doubles, row after
+         *       row, written through a memory mapping of the file
+         */
+        void output_to_binary(const string out_file) const;
+
+        /*!
+         * @brief npy output function, outputs the grid as a numpy .npy file
+         * @pre csvoutputter sol. vect. must have been previously ordered
+         * @param[in] out_file name of the path to create the file under
+         * @throw std::invalid_argument if sol. vect. has not been ordered, or
+         *        if out_file cannot be created
+         * @post creates an NPY (version 1.0) file holding the grid as a 2D
+         *       float64 array, written through a memory mapping of the file;
+         *       numpy.load reads it back without any parsing
+         */
+        void output_to_npy(const string out_file) const;
+
+        /*!
+         * @brief path output function, outputs the grid in the format its
+         *        file name asks for
+         * @pre csvoutputter sol. vect. must have been previously ordered
+         * @param[in] out_file name of the path to create the file under
+         * @throw std::invalid_argument if sol. vect. has not been ordered, or
+         *        if out_file cannot be created
+         * @post writes out_file with output_to_npy if it ends in .npy, with
+         *       output_to_binary if it ends in .bin and with output_to_file
+         *       (csv) otherwise
+         */
+        void output_to_path(const string out_file) const;
+
         /*!
          * @brief swap function, swaps contents of csvoutputter obj. a and b
          * @pre none
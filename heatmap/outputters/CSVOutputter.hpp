@@ -3,55 +3,39 @@ CSVOutputter::CSVOutputter(const MyVector<string> &bw, const MyVector<double> &s
     if(int(s.size()) != num)
         throw std::invalid_argument("sol. vect. size not equal to num in CSVO()");
 
-    bwm_sep.resize(bw.size());
-    bwm_sep = bw;
-
-    solution.resize(s.size());
-    solution = s;
-
-    n = num;
-
-    ordered_sol.resize(bwm_sep.size());
-    is_ordered = false;
+    reset(bw, s, num);
 }
 
-CSVOutputter::CSVOutputter(const CSVOutputter &csvo)
+CSVOutputter::CSVOutputter(const MyBitMask &mask, const MyVector<double> &s):
+    solution(s), bwm(mask, true), grid(), is_ordered(false)
 {
-    bwm_sep.resize(csvo.bwm_sep.size());
-    bwm_sep = csvo.bwm_sep;
-
-    solution.resize(csvo.solution.size());
-    solution = csvo.solution;
-
-    n = csvo.n;
-
-    ordered_sol.resize(csvo.ordered_sol.size());
-    is_ordered = csvo.is_ordered;    
+    if(s.size() != bwm.count())
+        throw std::invalid_argument("sol. vect. size not equal to unknowns in CSVO()");
 }
 
+CSVOutputter::CSVOutputter(const CSVOutputter &csvo): solution(csvo.solution),
+    bwm(csvo.bwm), grid(csvo.grid), is_ordered(csvo.is_ordered) {}
+
 void CSVOutputter::reset(const MyVector<string> &bw, const MyVector<double> &s, const int num)
 {
     if(int(s.size()) != num)
         throw std::invalid_argument("sol. vect. size not equal to num in reset()");
 
-    bwm_sep.resize(bw.size());
-    bwm_sep = bw;
+    MyBitRank ranked(MyBitMask(bw), true);
+    if(ranked.count() != s.size())
+        throw std::invalid_argument("num not equal to unknowns of b/w in reset()");
 
-    solution.resize(s.size());
     solution = s;
-
-    n = num;
-
-    ordered_sol.resize(bwm_sep.size());
+    swap(bwm, ranked);
+    grid = MyMatrix<double>();
     is_ordered = false;
 }
 
 void swap(CSVOutputter &a, CSVOutputter &b)
 {
-    swap(a.bwm_sep, b.bwm_sep);
     swap(a.solution, b.solution);
-    std::swap(a.n, b.n);
-    swap(a.ordered_sol, b.ordered_sol);
+    swap(a.bwm, b.bwm);
+    swap(a.grid, b.grid);
     std::swap(a.is_ordered, b.is_ordered);
 }
 
@@ -61,48 +45,64 @@ CSVOutputter& CSVOutputter::operator=(CSVOutputter csvo)
     return *this;
 }
 
-MyVector<string>& CSVOutputter::operator()()
+const MyMatrix<double>& CSVOutputter::operator()()
 {
     if(is_ordered) // if solution is already ordered, return it
-        return ordered_sol;
-    
-    // for each line in the black/white char matrix taken from file
-    int unknowns_remaining = n;
-    for(size_t curr_line = 0; curr_line < bwm_sep.size(); curr_line++)
+        return grid;
+
+    const size_t rows = bwm.rows();
+    const size_t cols = bwm.cols();
+    if(rows == 0 || cols == 0)
+        grid = MyMatrix<double>();
+    else
+        grid = MyMatrix<double>(rows, cols);
+
+    // the unknowns of a row are consecutive, so one rank finds the first
+    // and the set bits of the row, lowest first, take the ones after it;
+    // the grid starts out zero, so the 'W' pixels are never touched
+    const double *sol = solution.data();
+    for(size_t i = 0; i < rows; i++)
     {
-        // count the total number of unknowns in the given line
-        int num_unknowns_left = 0;
-        for(const auto &bw_char : bwm_sep[curr_line])
-            num_unknowns_left += (bw_char == 'B') ? 1 : 0;
-
-        // store the amount of unknowns we will order in this line
-        int unknowns_this_line = num_unknowns_left;
-
-        // for each character in the given line (both black and white)
-        for(size_t i = 0; i < bwm_sep[curr_line].size(); i++)
-        {
-            // if the character is a W, record a zero for its value
-            if(bwm_sep[curr_line][i] == 'W')
-                ordered_sol[curr_line] += "0";
-            
-            // otherwise, record the correct found B value from methods
-            if(bwm_sep[curr_line][i] == 'B')
-            {
-                ordered_sol[curr_line] += 
-                    std::to_string(solution[unknowns_remaining - num_unknowns_left]);
-                num_unknowns_left--;
-            }
-
-            // if we are not at the end of the line, add a comma
-            if(i != bwm_sep[curr_line].size() - 1)
-                ordered_sol[curr_line] += ",";
-        }
-
-        // subtract the total amount of unknowns by amount we fixed this line
-        unknowns_remaining -= unknowns_this_line;      
+        const uint64_t *words = bwm.row_ptr(i);
+        double *grid_row = grid.row_ptr(i);
+        size_t next = bwm.rank(i, 0);
+        for(size_t k = 0; k < bwm.row_words(); k++)
+            for(uint64_t w = words[k]; w != 0; w &= w - 1)
+                grid_row[k * MASK_WORD_BITS + mask_lowest_bit(w)] = sol[next++];
     }
     is_ordered = true; // set ordering to true (to save future computation)
-    return ordered_sol; // return ordered string vector, ready to print
+    return grid; // return grid of values, ready to print
+}
+
+void CSVOutputter::format_csv_row(const size_t i, string &line) const
+{
+    const uint64_t *words = bwm.row_ptr(i);
+    const double *grid_row = grid.row_ptr(i);
+    const size_t cols = bwm.cols();
+    char value[CSV_MAX_VALUE_CHARS];
+
+    // "%f" is what std::to_string formats with, but here the text goes
+    // straight into the line instead of into a new string per value
+    line.clear();
+    for(size_t j = 0; j < cols; j++)
+    {
+        if(!((words[j / MASK_WORD_BITS] >> (j % MASK_WORD_BITS)) & 1))
+            line += '0';
+        else
+            line.append(value, std::snprintf(value, sizeof(value), "%f",
+                grid_row[j]));
+
+        // if we are not at the end of the line, add a comma
+        if(j != cols - 1)
+            line += ',';
+    }
+}
+
+void CSVOutputter::copy_grid(char *dst) const
+{
+    const size_t row_bytes = grid.cols() * sizeof(double);
+    for(size_t i = 0; i < grid.rows(); i++)
+        std::memcpy(dst + i * row_bytes, grid.row_ptr(i), row_bytes);
 }
 
 void CSVOutputter::output_to_file(const string out_file) const
@@ -111,21 +111,80 @@ void CSVOutputter::output_to_file(const string out_file) const
         throw std::invalid_argument("cant print unsolved outputter to file");
     
     std::ofstream out_stream(out_file);
-    for(size_t i = 0; i < ordered_sol.size(); i++)
+    string line;
+    for(size_t i = 0; i < bwm.rows(); i++)
     {
-        out_stream << ordered_sol[i];
-        if(i != ordered_sol.size() - 1) 
-            out_stream << endl;
+        format_csv_row(i, line);
+        out_stream.write(line.data(), line.size());
+        if(i != bwm.rows() - 1) 
+            out_stream.put('\n');
     }
 }
 
+void CSVOutputter::output_to_binary(const string out_file) const
+{
+    if(!is_ordered)
+        throw std::invalid_argument("cant print unsolved outputter to file");
+
+    MappedFile mapped(out_file, grid.rows() * grid.cols() * sizeof(double));
+    copy_grid(mapped.data());
+}
+
+void CSVOutputter::output_to_npy(const string out_file) const
+{
+    if(!is_ordered)
+        throw std::invalid_argument("cant print unsolved outputter to file");
+
+    // a python dict literal describing the array, padded with spaces and a
+    // closing newline so the data after it starts NPY_HEADER_ALIGN aligned
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    const char *descr = ">f8";
+#else
+    const char *descr = "<f8";
+#endif
+    string header = string("{'descr': '") + descr +
+        "', 'fortran_order': False, 'shape': (" +
+        std::to_string(grid.rows()) + ", " + std::to_string(grid.cols()) +
+        "), }";
+    const size_t prefix = 10; // magic, version and header length
+    size_t total = prefix + header.size() + 1;
+    total += (NPY_HEADER_ALIGN - total % NPY_HEADER_ALIGN) % NPY_HEADER_ALIGN;
+    header.resize(total - prefix - 1, ' ');
+    header += '\n';
+
+    MappedFile mapped(out_file,
+        total + grid.rows() * grid.cols() * sizeof(double));
+    char *dst = mapped.data();
+    std::memcpy(dst, "\x93NUMPY\x01\x00", 8);
+    dst[8] = char(header.size() & 0xff);
+    dst[9] = char(header.size() >> 8);
+    std::memcpy(dst + prefix, header.data(), header.size());
+    copy_grid(dst + total);
+}
+
+void CSVOutputter::output_to_path(const string out_file) const
+{
+    const string extension = out_file.substr(std::min(out_file.rfind('.'),
+        out_file.size()));
+    if(extension == ".npy")
+        output_to_npy(out_file);
+    else if(extension == ".bin")
+        output_to_binary(out_file);
+    else
+        output_to_file(out_file);
+}
+
 ostream& operator<<(ostream &out, const CSVOutputter &csvo)
 {
     if(!csvo.is_ordered)
         throw std::invalid_argument("cant print unsolved outputter");
     
-    for(const auto &line : csvo.ordered_sol)
-        out << line << endl;
+    string line;
+    for(size_t i = 0; i < csvo.bwm.rows(); i++)
+    {
+        csvo.format_csv_row(i, line);
+        out << line << '\n';
+    }
     
     return out;
-}
\ No newline at end of file
+}
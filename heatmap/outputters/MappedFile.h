@@ -0,0 +1,69 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+using std::string;
+
+/*!
+ * @brief mapped file class, a file of fixed size mapped into memory for
+ *        writing; bytes stored through data() land in the page cache
+ *        directly, without the copies and flushes of a stream
+ */
+class MappedFile
+{
+    private:
+        char *m_data; //! start of the mapping, nullptr for an empty file
+        size_t m_size; //! size of the file and of the mapping in bytes
+        int m_fd; //! descriptor of the open file, -1 when none is open
+
+    public:
+        /*!
+         * @brief param. constructor, creates file path of size bytes and maps it
+         * @pre none
+         * @param[in] path name of the file to create, replaced if it exists
+         * @param[in] size size of the file in bytes
+         * @throw std::invalid_argument if path cannot be created, sized or
+         *        mapped
+         * @post creates path holding size zero bytes, mapped shared and
+         *       writable, so writes through data() end up in the file
+         */
+        MappedFile(const string &path, const size_t size);
+
+        /*!
+         * @brief destructor, unmaps and closes the file
+         * @pre none
+         * @post unmaps the file, leaving the kernel to write back the pages,
+         *       and closes it
+         */
+        ~MappedFile();
+
+        /*! a mapping has a single owner, copying it would unmap it twice */
+        MappedFile(const MappedFile &mf) = delete;
+
+        /*! a mapping has a single owner, copying it would unmap it twice */
+        MappedFile& operator=(const MappedFile &mf) = delete;
+
+        /*!
+         * @brief data function, returns pointer to the mapped bytes
+         * @pre none
+         * @post none
+         * @returns pointer to the size() bytes of the file
+         */
+        char* data() { return m_data; }
+
+        /*!
+         * @brief size function, returns size of the file in bytes
+         * @pre none
+         * @post none
+         * @returns the size of the file in bytes
+         */
+        size_t size() const { return m_size; }
+};
+
+#include "MappedFile.hpp"
+
+#endif
@@ -0,0 +1,34 @@
+MappedFile::MappedFile(const string &path, const size_t size): m_data(nullptr),
+    m_size(size), m_fd(-1)
+{
+    m_fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if(m_fd < 0)
+        throw std::invalid_argument("cant create file to map: " + path);
+
+    // the file has to be as long as the mapping before pages are touched,
+    // and a zero length mapping is an error, so empty files stay unmapped
+    if(ftruncate(m_fd, off_t(size)) != 0)
+    {
+        close(m_fd);
+        throw std::invalid_argument("cant size file to map: " + path);
+    }
+    if(size == 0)
+        return;
+
+    void *mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+        m_fd, 0);
+    if(mapping == MAP_FAILED)
+    {
+        close(m_fd);
+        throw std::invalid_argument("cant map file: " + path);
+    }
+    m_data = static_cast<char*>(mapping);
+}
+
+MappedFile::~MappedFile()
+{
+    if(m_data != nullptr)
+        munmap(m_data, m_size);
+    if(m_fd >= 0)
+        close(m_fd);
+}
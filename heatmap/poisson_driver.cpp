@@ -1,9 +1,12 @@
 #include <iostream>
 #include <chrono>
+#include <thread>
 #include "containers/MyMatrix.h"
+#include "containers/MySparseMatrix.h"
+#include "inputters/ManifestInputter.h"
 #include "matrix-solvers/PoissonMatrixMaker.h"
-#include "matrix-solvers/CholeskyDecomp.h"
-#include "matrix-solvers/SuccessiveOR.h"
+#include "matrix-solvers/PoissonStencil.h"
+#include "matrix-solvers/PoissonBatch.h"
 #include "outputters/CSVOutputter.h"
 
 using std::cout;
@@ -13,51 +16,82 @@ using std::chrono::duration_cast;
 
 int main(int argc, char** argv)
 {
-    if(argc != 3)
-        throw std::invalid_argument("wrong amount of cmd line arguments");
-    
-    MyVector<string> bwm_sep(1);
-    MyMatrix<double> A = calc_poisson_matrix(string(argv[1]), bwm_sep);
-    MyVector<double> b = calc_poisson_vector(A.rows(), forcing_func());
-
-    char method;
-    cout << "Choose method, type C for Cholesky, S for SOR method: ";
-    cin >> method;
-
-    while(method != 'C' && method != 'S')
+    // poisson_driver --batch manifest [workers] runs every job of a manifest
+    // without prompting, see read_manifest_line for its lines
+    if(argc >= 2 && string(argv[1]) == "--batch")
     {
-        cout << "invalid argument, type a C or an S: ";
-        cin >> method;
+        if(argc != 3 && argc != 4)
+            throw std::invalid_argument("usage: --batch manifest [workers]");
+        size_t workers = 0;
+        if(argc == 4)
+        {
+            char *end = nullptr;
+            workers = std::strtoul(argv[3], &end, 10);
+            if(*end != '\0' || argv[3][0] == '-')
+                throw std::invalid_argument("workers must be a count");
+        }
+        MyVector<PoissonJob> jobs = read_manifest(string(argv[2]));
+        const size_t failed = run_poisson_batch(jobs, workers, cout);
+        cout << jobs.size() - failed << " of " << jobs.size()
+             << " jobs completed" << endl;
+        return (failed == 0) ? 0 : 1;
     }
 
-    MyVector<double> x(b.size());
-    if(method == 'C')
+    // poisson_driver grid output [method [tolerance]], prompting for the
+    // method only if it is not given
+    if(argc < 3 || argc > 5)
+        throw std::invalid_argument("wrong amount of cmd line arguments");
+
+    PoissonJob job;
+    job.input = argv[1];
+    job.output = argv[2];
+    if(argc >= 4)
     {
-        cout << "Starting Cholesky Decomp..." << endl;
-        auto start = std::chrono::high_resolution_clock::now();
-        CholeskyDecomp cholesky(A);
-        x = cholesky(b);
-        auto stop = std::chrono::high_resolution_clock::now();
-        auto dur = duration_cast<std::chrono::milliseconds>(stop - start);
-        cout << "Cholesky Decomp Finish Time: " << dur.count() << endl << endl;
+        job.method = read_method(argv[3], "");
+        job.tolerance = (argc == 5) ? read_tolerance(argv[4], "") : 0;
     }
-    else if(method == 'S')
+    else
     {
-        cout << "Starting Successive OR..." << endl;
-        auto start = std::chrono::high_resolution_clock::now();
-        SuccessiveOR successive_or(A);
-        x = successive_or(b, get_w_value(), 0.01);
-        auto stop = std::chrono::high_resolution_clock::now();
-        auto dur = duration_cast<std::chrono::milliseconds>(stop - start);
-        cout << "Successive OR Finish Time (ms): " << dur.count() << endl << endl;        
+        cout << "Choose method, type C for Cholesky, S for SOR method, "
+             << "A for adaptive SOR, R for red-black SOR, G for conjugate "
+             << "gradient, M for multigrid: ";
+        cin >> job.method;
+
+        while(!is_poisson_method(job.method))
+        {
+            cout << "invalid argument, type a C, an S, an A, an R, a G or an "
+                 << "M: ";
+            cin >> job.method;
+        }
     }
 
-    cout << "Writing Solution to CSV..." << endl;
-    CSVOutputter csv_outputter(bwm_sep, x, x.size());
+    // the grid is a b/w text file or a pgm/ppm image thresholded straight
+    // into a bit mask; the iterative methods only ever need rows of A,
+    // which the stencil computes from the mask's numbering on the fly
+    PoissonCache cache;
+    std::shared_ptr<const PoissonInput> input = cache.input(job.input);
+
+    const string name = poisson_method_name(job.method);
+    const size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+    cout << "Starting " << name << "..." << endl;
+    auto start = std::chrono::high_resolution_clock::now();
+    string stats;
+    MyVector<double> x = solve_poisson(job, *input, cache, threads, stats);
+    auto stop = std::chrono::high_resolution_clock::now();
+    auto dur = duration_cast<std::chrono::milliseconds>(stop - start);
+    if(!stats.empty())
+        cout << name << " " << stats << endl;
+    cout << name << " Finish Time (ms): " << dur.count() << endl << endl;
+
+    // the extension of the output file picks the format, .npy for numpy,
+    // .bin for raw doubles and csv for anything else
+    cout << "Writing Solution..." << endl;
+    CSVOutputter csv_outputter(input->mask, x);
     csv_outputter();
-    csv_outputter.output_to_file(string(argv[2]));
+    csv_outputter.output_to_path(job.output);
 
-    cout << "Program completed, solution in csv. Thanks!" << endl;
+    cout << "Program completed, solution in " << job.output << ". Thanks!"
+         << endl;
 
     return 0;
-}
\ No newline at end of file
+}
@@ -91,9 +91,10 @@ void QuantumRegister<Q>::apply_gate(const QuantumGate &qg)
     
     MyComplex<double> old_zero = reg[0];
     MyComplex<double> old_one = reg[1];
+    const MyMatrix<MyComplex<double>> &gate = qg.get_gate();
     
-    reg[0] = (old_zero * qg.get_gate()[0][0]) + (old_one * qg.get_gate()[1][0]);
-    reg[1] = (old_zero * qg.get_gate()[0][1]) + (old_one * qg.get_gate()[1][1]);
+    reg[0] = (old_zero * gate[0][0]) + (old_one * gate[1][0]);
+    reg[1] = (old_zero * gate[0][1]) + (old_one * gate[1][1]);
 }
 
 template <int Q>
@@ -2,6 +2,7 @@
 #define MY_MATRIX_H
 
 #include "MyVector.h"
+#include "../../common/MyBoundsCheck.h"
 #include "../MyComplex.h"
 using std::initializer_list;
 
@@ -11,6 +12,9 @@ using std::initializer_list;
 template <typename T>
 class MyMatrix;
 
+template <typename T>
+class MyLUDecomp;
+
 /*! extraction operator, outputs contents of src to console
  * @brief extraction operator, outputs contents of src to console
  * @pre none
@@ -35,14 +39,13 @@ istream& operator>>(istream &in, MyMatrix<T> &src);
 
 /*! swap function, swaps contents of a and b
  * @brief swap function, swaps contents of a and b
- * @pre a and b must be matrices of same size
+ * @pre none
  * @param[in,out] a matrix object, lhs of the swap function
  * @param[in,out] b matrix object, rhs of the swap function
- * @throw std::invalid_argument if a and b are not the same size
- * @post swaps the matrix contents of a and b
+ * @post swaps the matrix contents (and sizes) of a and b
  */
 template <typename T>
-void swap(MyMatrix<T> &a, MyMatrix<T> &b);
+void swap(MyMatrix<T> &a, MyMatrix<T> &b) noexcept;
 
 /*! matrix addition, adds matrices a and b and returns new matrix
  * @brief matrix addition, adds matrices a and b and returns new matrix
@@ -55,6 +58,17 @@ void swap(MyMatrix<T> &a, MyMatrix<T> &b);
 template <typename T>
 MyMatrix<T> operator+(const MyMatrix<T> &a, const MyMatrix<T> &b);
 
+/*! matrix addition, adds b into the storage of the temporary a
+ * @brief matrix addition, adds b into temporary a and returns it
+ * @pre type T must be capable of addition, a and b are same size
+ * @param[in,out] a temporary matrix object, reused for the result
+ * @param[in] b matrix object, rhs of addition operator
+ * @post adds the contents of b to a in place, no new matrix is allocated
+ * @returns a, moved out after all addition completed
+ */
+template <typename T>
+MyMatrix<T> operator+(MyMatrix<T> &&a, const MyMatrix<T> &b);
+
 /*! matrix subtraction, minus matrices a and b and returns new matrix
  * @brief matrix subtraction, minus matrices a and b and returns new matrix
  * @pre type T must be capable of subtraction, a and b are same size
@@ -66,6 +80,17 @@ MyMatrix<T> operator+(const MyMatrix<T> &a, const MyMatrix<T> &b);
 template <typename T>
 MyMatrix<T> operator-(const MyMatrix<T> &a, const MyMatrix<T> &b);
 
+/*! matrix subtraction, subtracts b from the storage of the temporary a
+ * @brief matrix subtraction, minus b from temporary a and returns it
+ * @pre type T must be capable of subtraction, a and b are same size
+ * @param[in,out] a temporary matrix object, reused for the result
+ * @param[in] b matrix object, rhs of subtraction operator
+ * @post subtracts the contents of b from a in place, no new allocation
+ * @returns a, moved out after all subtraction completed
+ */
+template <typename T>
+MyMatrix<T> operator-(MyMatrix<T> &&a, const MyMatrix<T> &b);
+
 /*! matrix multiplication, multiples matrices a and b, returns result
  * @brief matrix multiplying, multiples matrices a and b, return result
  * @pre type T must be capable of addition and multiplication, the cols of
@@ -101,6 +126,17 @@ MyMatrix<T> operator*(const T a, const MyMatrix<T> &b);
 template <typename T>
 MyMatrix<T> operator*(const MyMatrix<T> &a, const T b);
 
+/*! scalar multiplication, scales the storage of the temporary a by b
+ * @brief scalar multiplication, multiplies temporary matrix a by scalar b
+ * @pre type T must be capable of multiplication
+ * @param[in,out] a temporary matrix, reused for the result
+ * @param[in] b scalar value of type T to be multiplied by elements of a
+ * @post multiples each value of matrix a by scalar b in place
+ * @returns a, moved out after all multiplication is completed
+ */
+template <typename T>
+MyMatrix<T> operator*(MyMatrix<T> &&a, const T b);
+
 /*! vector * matrix multiplication, multiplies vector a by matrix b
  * @brief vector*matrix multiplication, multiplies vector a by matrix b
  * @pre type T must be capable of multiplication, the rows of matrix b must
@@ -139,7 +175,12 @@ class MyMatrix
         size_t c; //! the number of columns in the matrix
 
     public:
-        MyMatrix() = default;
+        /*!
+         * @brief default constructor, create empty matrix of size 0x0
+         * @pre none
+         * @post creates empty matrix object of size 0 x 0
+         */
+        MyMatrix(): m_data(nullptr), r(0), c(0) {}
 
         /*! Parameterized constructor, given a 2D initializer list
          * @brief param. constructor, create matrix given 2d initializer list
@@ -175,30 +216,40 @@ class MyMatrix
          */
         MyMatrix(const MyMatrix<T> &a);
 
+        /*! move constructor, takes over the storage of 'a'
+         * @brief move constructor, takes over storage of matrix 'a'
+         * @pre none
+         * @param[in,out] a matrix object whose storage is taken over
+         * @post creates an MyMatrix object owning a's storage, leaves 'a'
+         *       an empty 0 x 0 matrix
+         */
+        MyMatrix(MyMatrix<T> &&a) noexcept;
+
         /*! assignment operator, returns calling object after copied from 'a'
          * @brief assignment operator, copies 'a' object and returns new obj
          * @pre none
-         * @param[in] a matrix object to be copied to calling object
+         * @param[in] a matrix object to be copied to calling object, moved
+         *            (not copied) into when assigning from a temporary
          * @post creates a new MyMatrix object copied from 'a'
          * @returns the new equivalent MyMatrix object
          */
         MyMatrix<T>& operator=(MyMatrix<T> a);
 
-        /*! subscript operator, returns vector in matrix at index i by copy
+        /*! subscript operator, returns vector in matrix at index i by ref.
          * @brief subscript operator, returns vector in matrix at index i
-         * @pre i must be a positive number (>0)
+         * @pre i must be in range 0 <= i < rows()
          * @param[in] i a positive size_t to access MyMatrix from
-         * @throw std::invalid_argument if i is not positive
-         * @post accesses the vector at index i
-         * @returns copy of the accessed vector at index i
+         * @throw std::out_of_range if i >= rows() and BOUNDS_CHECKED
+         * @post accesses the vector at index i, without copying it
+         * @returns read-only reference to the accessed vector at index i
          */
-        MyVector<T> operator[](const size_t i) const;
+        const MyVector<T>& operator[](const size_t i) const;
 
         /*! subscript operator, returns reference to vector at index i
          * @brief subscript operator, return ref. to vector at index i
-         * @pre i must be a positive number (>0)
+         * @pre i must be in range 0 <= i < rows()
          * @param[in] i a positive size_t to access MyMatrix from
-         * @throw std::invalid_argument if i is not positive
+         * @throw std::out_of_range if i >= rows() and BOUNDS_CHECKED
          * @post accesses the vector at index i
          * @returns reference to vector at index i
          */
@@ -206,10 +257,11 @@ class MyMatrix
 
         /*! evaluation operator, returns copy of element at matrix[i][j]
          * @brief eval. operator, returns copy of element at matrix[i][j]
-         * @pre i and j must be positive numbers (>0)
+         * @pre i and j must be in range of the matrix
          * @param[in] i the index of the row to access in matrix
          * @param[in] j the index of the col to access in matrix
-         * @throw std::invalid_argument if i or j is not positive
+         * @throw std::out_of_range if i >= rows() or j >= cols(), and
+         *        BOUNDS_CHECKED
          * @post access the T value at index matrix[i][j]
          * @returns a copy of the accessed T value at matrix[i][j]
          */
@@ -217,10 +269,11 @@ class MyMatrix
 
         /*! evaluation operator, returns ref. of element at matrix[i][j]
          * @brief eval. operator, returns ref. of element at matrix[i][j]
-         * @pre i and j must be positive numbers (>0)
+         * @pre i and j must be in range of the matrix
          * @param[in] i the index of the row to access in matrix
          * @param[in] j the index of the col to access in matrix
-         * @throw std::invalid_argument if i or j is not positive
+         * @throw std::out_of_range if i >= rows() or j >= cols(), and
+         *        BOUNDS_CHECKED
          * @post access the T value at index matrix[i][j]
          * @returns a reference to the accessed T value at matrix[i][j]
          */
@@ -242,6 +295,26 @@ class MyMatrix
          */
         size_t cols() const { return c; }
 
+        /*! row pointer function, returns pointer to row i, unchecked
+         * @brief row pointer function, returns pointer to start of row i
+         * @pre i must be in range 0 <= i < rows()
+         * @param[in] i the index of the row
+         * @post returns pointer to the cols() elements of row i; never
+         *       checks i, so kernels indexing it can be vectorized
+         * @returns pointer to element (i, 0)
+         */
+        T* row_ptr(const size_t i) { return m_data[i].data(); }
+
+        /*! row pointer function, returns pointer to row i, unchecked
+         * @brief row pointer function, returns read-only ptr to row i
+         * @pre i must be in range 0 <= i < rows()
+         * @param[in] i the index of the row
+         * @post returns pointer to the cols() elements of row i; never
+         *       checks i, so kernels indexing it can be vectorized
+         * @returns pointer to element (i, 0)
+         */
+        const T* row_ptr(const size_t i) const { return m_data[i].data(); }
+
         /*! unary minus, returns new matrix, all the elements are negative
          * @brief unary minus, returns new matrix with elements inverted
          * @pre type T must be capable of being made negative
@@ -250,39 +323,70 @@ class MyMatrix
          */
         MyMatrix<T>& operator-();
 
+        /*! addition assignment, adds matrix a to the calling matrix in place
+         * @brief addition assignment, adds matrix a to calling obj. in place
+         * @pre type T must be capable of addition, a is same size as call obj.
+         * @param[in] a matrix object, rhs of addition
+         * @throw std::invalid_argument if a is a different size
+         * @post adds each element of a to the calling matrix, no allocation
+         * @returns the modified calling object
+         */
+        MyMatrix<T>& operator+=(const MyMatrix<T> &a);
+
+        /*! subtraction assignment, subtracts a from calling matrix in place
+         * @brief subtraction assignment, minus matrix a from call obj. in place
+         * @pre type T must be capable of subtraction, a is same size as call obj.
+         * @param[in] a matrix object, rhs of subtraction
+         * @throw std::invalid_argument if a is a different size
+         * @post subtracts each element of a from calling matrix, no allocation
+         * @returns the modified calling object
+         */
+        MyMatrix<T>& operator-=(const MyMatrix<T> &a);
+
+        /*! multiplication assignment, scales the calling matrix in place
+         * @brief scalar mult. assignment, multiplies call obj. by b in place
+         * @pre type T must be capable of multiplication
+         * @param[in] b scalar value of type T to multiply every element by
+         * @post multiplies each element of the calling matrix by b
+         * @returns the modified calling object
+         */
+        MyMatrix<T>& operator*=(const T b);
+
         /*! identity helper function, create identity matrix same size as call
          * @brief identity function, creates identity matrix same size as call
          * @pre none
          * @post creates identity matrix with same size as calling object
-         * @returns identity matrix with same size as calling object with ints
+         * @returns identity matrix with same size as calling object
          */
-        MyMatrix<int> identity();
+        MyMatrix<T> identity() const;
 
         /*! transpose helper function, transposes the calling matrix
          * @brief transpose helper function, transposes the calling matrix
          * @pre none
-         * @post transposes the calling matrix
+         * @post builds the (cols x rows) transpose, bands of rows of the
+         *       calling matrix in parallel
          * @returns a copy of this matrix transposed
          */
         MyMatrix<T> transpose();
 
-        /*! invert function, performs matrix inversion based on newton-schulz
-         * @brief invert function, inverts matrix based on newton-schulz method
-         * @pre none
-         * @post inverts the calling object using the newton-schulz method
+        /*! invert function, performs matrix inversion by lu decomposition
+         * @brief invert function, inverts matrix via MyLUDecomp
+         * @pre calling object must be square and not singular
+         * @throw std::invalid_argument if not square or singular
+         * @post factors the calling object with partial pivoting and solves
+         *       for the identity, O(n^3) whatever the entries are
          * @returns a new matrix equal to inverse of calling object
          */
         MyMatrix<T> invert() const;
 
         /*! swap function, swaps contents of a and b
          * @brief swap function, swaps contents of a and b
-         * @pre a and b must be matrices of same size
+         * @pre none
          * @param[in,out] a matrix object, lhs of the swap function
          * @param[in,out] b matrix object, rhs of the swap function
-         * @throw std::invalid_argument if a and b are not the same size
-         * @post swaps the matrix contents of a and b
+         * @post swaps the matrix contents (and sizes) of a and b
          */
-        friend void swap<T>(MyMatrix<T> &a, MyMatrix<T> &b);
+        friend void swap<T>(MyMatrix<T> &a, MyMatrix<T> &b) noexcept;
 
         /*! extraction operator, outputs contents of src to console
          * @brief extraction operator, outputs contents of src to console
@@ -306,5 +410,6 @@ class MyMatrix
 };
 
 #include "MyMatrix.hpp"
+#include "../../common/MyLUDecomp.h"
 
 #endif
\ No newline at end of file
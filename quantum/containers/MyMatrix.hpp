@@ -50,30 +50,30 @@ MyMatrix<T>::MyMatrix(const size_t rows, const size_t cols)
 template <typename T>
 MyMatrix<T>::MyMatrix(const MyMatrix<T> &a)
 {
-    m_data = new MyVector<T>[a.rows()];
-    for(size_t i = 0; i < a.rows(); i++)
-        m_data[i] = MyVector<T>(a.cols());
-
     r = a.rows();
     c = a.cols();
 
+    // copy whole rows, each MyVector copies its storage in one pass
+    m_data = new MyVector<T>[r];
     for(size_t i = 0; i < r; i++)
-    {
-        for(size_t j = 0; j < c; j++)
-            m_data[i][j] = a[i][j];
-    }
+        m_data[i] = a.m_data[i];
 }
 
 template <typename T>
-void swap(MyMatrix<T> &a, MyMatrix<T> &b)
+MyMatrix<T>::MyMatrix(MyMatrix<T> &&a) noexcept: m_data(a.m_data), r(a.r),
+    c(a.c)
 {
-    if(a.rows() != b.rows() || a.cols() != b.cols())
-        throw std::invalid_argument("swap function a size DNE b size");
-    for(size_t i = 0; i < a.rows(); i++)
-    {
-        for(size_t j = 0; j < a.cols(); j++)
-            std::swap(a.m_data[i][j], b.m_data[i][j]);
-    }
+    a.m_data = nullptr;
+    a.r = 0;
+    a.c = 0;
+}
+
+template <typename T>
+void swap(MyMatrix<T> &a, MyMatrix<T> &b) noexcept
+{
+    std::swap(a.m_data, b.m_data);
+    std::swap(a.r, b.r);
+    std::swap(a.c, b.c);
 }
 
 template <typename T>
@@ -84,34 +84,32 @@ MyMatrix<T>& MyMatrix<T>::operator=(MyMatrix<T> a)
 }
 
 template <typename T>
-MyVector<T> MyMatrix<T>::operator[](const size_t i) const
+const MyVector<T>& MyMatrix<T>::operator[](const size_t i) const
 {
-    if(i < 0)
-        throw std::invalid_argument("[i] for matrix is negative");
+    check_index(i, r, "[i] for matrix is out of range");
     return m_data[i];
 }
 
 template <typename T>
 MyVector<T>& MyMatrix<T>::operator[](const size_t i)
 {
-    if(i < 0)
-        throw std::invalid_argument("[i] for matrix is negative");
+    check_index(i, r, "[i] for matrix is out of range");
     return *&m_data[i];
 }
 
 template <typename T>
 T MyMatrix<T>::operator()(const size_t i, const size_t j) const
 {
-    if(i < 0 || j < 0)
-        throw std::invalid_argument("negative index for matrix(i, j) call");
+    check_index(i, r, "index out of range for matrix(i, j) call");
+    check_index(j, c, "index out of range for matrix(i, j) call");
     return m_data[i][j];
 }
 
 template <typename T>
 T& MyMatrix<T>::operator()(const size_t i, const size_t j)
 {
-    if(i < 0 || j < 0)
-        throw std::invalid_argument("negative index for matrix(i, j) call");
+    check_index(i, r, "index out of range for matrix(i, j) call");
+    check_index(j, c, "index out of range for matrix(i, j) call");
     return *&m_data[i][j];
 }
 
@@ -126,6 +124,45 @@ MyMatrix<T>& MyMatrix<T>::operator-()
     return *this;
 }
 
+template <typename T>
+MyMatrix<T>& MyMatrix<T>::operator+=(const MyMatrix<T> &a)
+{
+    if(a.rows() != rows() || a.cols() != cols())
+        throw std::invalid_argument("cant add matrices, different sizes");
+
+    parallel_for(r, c, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            m_data[i] += a.m_data[i];
+    });
+    return *this;
+}
+
+template <typename T>
+MyMatrix<T>& MyMatrix<T>::operator-=(const MyMatrix<T> &a)
+{
+    if(a.rows() != rows() || a.cols() != cols())
+        throw std::invalid_argument("cant minus matrices, different sizes");
+
+    parallel_for(r, c, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            m_data[i] -= a.m_data[i];
+    });
+    return *this;
+}
+
+template <typename T>
+MyMatrix<T>& MyMatrix<T>::operator*=(const T b)
+{
+    parallel_for(r, c, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            m_data[i] *= b;
+    });
+    return *this;
+}
+
 template <typename T>
 ostream& operator<<(ostream &out, const MyMatrix<T> &src)
 {
@@ -161,15 +198,18 @@ MyMatrix<T> operator+(const MyMatrix<T> &a, const MyMatrix<T> &b)
     if(a.rows() != b.rows() || a.cols() != b.cols())
         throw std::invalid_argument("cant add matrices, different sizes");
 
-    MyMatrix<T> added_matrix(a.rows(), a.cols());
-    for(size_t i = 0; i < a.rows(); i++)
-    {
-        for(size_t j = 0; j < a.cols(); j++)
-            added_matrix[i][j] = a[i][j] + b[i][j];
-    }
+    MyMatrix<T> added_matrix(a);
+    added_matrix += b;
     return added_matrix;
 }
 
+template <typename T>
+MyMatrix<T> operator+(MyMatrix<T> &&a, const MyMatrix<T> &b)
+{
+    a += b;
+    return std::move(a);
+}
+
 MyMatrix<float> operator+(const MyMatrix<int> &a, const MyMatrix<float> &b)
 {
     if(a.rows() != b.rows() || a.cols() != b.cols())
@@ -190,13 +230,16 @@ MyMatrix<T> operator-(const MyMatrix<T> &a, const MyMatrix<T> &b)
     if(a.rows() != b.rows() || a.cols() != b.cols())
         throw std::invalid_argument("cant minus matrices, different sizes");
 
-    MyMatrix<T> added_matrix(a.rows(), a.cols());
-    for(size_t i = 0; i < a.rows(); i++)
-    {
-        for(size_t j = 0; j < a.cols(); j++)
-            added_matrix[i][j] = a[i][j] - b[i][j];
-    }
-    return added_matrix;
+    MyMatrix<T> diff_matrix(a);
+    diff_matrix -= b;
+    return diff_matrix;
+}
+
+template <typename T>
+MyMatrix<T> operator-(MyMatrix<T> &&a, const MyMatrix<T> &b)
+{
+    a -= b;
+    return std::move(a);
 }
 
 MyMatrix<float> operator-(const MyMatrix<int> &a, const MyMatrix<float> &b)
@@ -219,17 +262,23 @@ MyMatrix<T> operator*(const MyMatrix<T> &a, const MyMatrix<T> &b)
     if(a.cols() != b.rows())
         throw std::invalid_argument("cant mult. matrices, incompat. sizes");
     
+    // rows of the product are independent, so bands of them run in parallel
     MyMatrix<T> product(a.rows(), b.cols());
-    for(size_t i = 0; i < product.rows(); i++)
+    parallel_for(product.rows(), a.cols() * b.cols(),
+        [&](const size_t lo, const size_t hi)
     {
-        for(size_t j = 0; j < product.cols(); j++)
+        for(size_t i = lo; i < hi; i++)
         {
-            T curr_sum = 0;
-            for(size_t curr_i = 0; curr_i < a.cols(); curr_i++)
-                curr_sum += (a[i][curr_i] * b[curr_i][j]);
-            product[i][j] = curr_sum;
+            const MyVector<T> &a_row = a[i];
+            for(size_t j = 0; j < product.cols(); j++)
+            {
+                T curr_sum = 0;
+                for(size_t curr_i = 0; curr_i < a.cols(); curr_i++)
+                    curr_sum += (a_row[curr_i] * b[curr_i][j]);
+                product[i][j] = curr_sum;
+            }
         }
-    }
+    });
     return product;
 }
 
@@ -243,14 +292,17 @@ template <typename T>
 MyMatrix<T> operator*(const MyMatrix<T> &a, const T b)
 {
     MyMatrix<T> scaled_matrix(a);
-    for(size_t i = 0; i < a.rows(); i++)
-    {
-        for(size_t j = 0; j < a.cols(); j++)
-            scaled_matrix[i][j] *= b;
-    }
+    scaled_matrix *= b;
     return scaled_matrix;
 }
 
+template <typename T>
+MyMatrix<T> operator*(MyMatrix<T> &&a, const T b)
+{
+    a *= b;
+    return std::move(a);
+}
+
 template <typename T>
 MyMatrix<T> operator*(const MyVector<T> &a, const MyMatrix<T> &b)
 {
@@ -275,20 +327,23 @@ MyMatrix<T> operator*(const MyMatrix<T> &a, const MyVector<T> &b)
         throw std::invalid_argument("cant mult. vect/matrix, incompat. sizes");
     
     MyMatrix<T> product(b.size(), 1);
-    for(size_t i = 0; i < product.rows(); i++)
+    parallel_for(product.rows(), a.cols(), [&](const size_t lo, const size_t hi)
     {
-        T curr_sum = 0;
-        for(size_t curr_r = 0; curr_r < a.cols(); curr_r++)
-            curr_sum += (a[i][curr_r] * b[curr_r]);
-        product[i][0] = curr_sum;
-    }
+        for(size_t i = lo; i < hi; i++)
+        {
+            T curr_sum = 0;
+            for(size_t curr_r = 0; curr_r < a.cols(); curr_r++)
+                curr_sum += (a[i][curr_r] * b[curr_r]);
+            product[i][0] = curr_sum;
+        }
+    });
     return product;
 }
 
 template <typename T>
-MyMatrix<int> MyMatrix<T>::identity()
+MyMatrix<T> MyMatrix<T>::identity() const
 {
-    MyMatrix<int> iden(rows(), cols());
+    MyMatrix<T> iden(rows(), cols());
     for(size_t i = 0; i < rows(); i++)
     {
         for(size_t j = 0; j < cols(); j++)
@@ -305,103 +360,22 @@ MyMatrix<int> MyMatrix<T>::identity()
 template <typename T>
 MyMatrix<T> MyMatrix<T>::transpose()
 {
-    MyMatrix<T> this_copy(*this);
-    for(size_t i = 0; i < rows(); i++)
+    // each piece owns a band of rows here, so its writes to the columns of
+    // the transpose never overlap another piece's
+    MyMatrix<T> transposed(c, r);
+    parallel_for(r, c, [&](const size_t lo, const size_t hi)
     {
-        for(size_t j = 0; j < rows(); j++)
-            this_copy[j][i] = operator[](i).operator[](j);
-    }
-    return this_copy;
+        for(size_t i = lo; i < hi; i++)
+        {
+            for(size_t j = 0; j < c; j++)
+                transposed.m_data[j][i] = m_data[i][j];
+        }
+    });
+    return transposed;
 }
 
 template <typename T>
 MyMatrix<T> MyMatrix<T>::invert() const
 {
-    T row_sum, col_sum;
-
-    T sum = 0;
-    for(size_t i = 0; i < rows(); i++)
-    {
-        for(size_t j = 0; j < cols(); j++)
-            sum += m_data[i][j];
-        if(i == 0 || sum > row_sum)
-            row_sum = sum;
-    }
-    sum = 0;
-    for(size_t j = 0; j < cols(); j++)
-    {
-        for(size_t i = 0; i < rows(); i++)
-            sum += m_data[i][j];
-        if(j == 0 || sum > col_sum)
-            col_sum = sum;
-    }
-
-    T t = 1 / (row_sum * col_sum);
-    MyMatrix<T> this_transpose(*this);
-    this_transpose.transpose();
-
-    MyMatrix<T> b = t * this_transpose;
-    bool is_accurate = false;
-    while(!is_accurate)
-    {
-        MyMatrix<T> e = this_transpose.identity() - (b * *this);
-        b = (this_transpose.identity() + e) * b;
-
-        is_accurate = true;
-        for(size_t i = 0; i < b.rows(); i++)
-        {
-            for(size_t j = 0; j < b.cols(); j++)
-            {
-                if(b[i][j] > 0.001)
-                    is_accurate = false;
-            }
-        }
-    }
-    return b;
+    return MyLUDecomp<T>(*this).inverse();
 }
-
-template <>
-MyMatrix<float> MyMatrix<float>::invert() const
-{
-    float row_sum, col_sum;
-
-    float sum = 0;
-    for(size_t i = 0; i < rows(); i++)
-    {
-        for(size_t j = 0; j < cols(); j++)
-            sum += m_data[i][j];
-        if(i == 0 || sum > row_sum)
-            row_sum = sum;
-    }
-    sum = 0;
-    for(size_t j = 0; j < cols(); j++)
-    {
-        for(size_t i = 0; i < rows(); i++)
-            sum += m_data[i][j];
-        if(j == 0 || sum > col_sum)
-            col_sum = sum;
-    }
-
-    float t = 1.0 / (row_sum * col_sum);
-    MyMatrix<float> this_transpose(*this);
-    this_transpose.transpose();
-
-    MyMatrix<float> b = t * this_transpose;
-    bool is_accurate = false;
-    while(!is_accurate)
-    {
-        MyMatrix<float> e = (this_transpose.identity() - (b * *this));
-        b = (this_transpose.identity() + e) * b;
-
-        is_accurate = true;
-        for(size_t i = 0; i < b.rows(); i++)
-        {
-            for(size_t j = 0; j < b.cols(); j++)
-            {
-                if(b[i][j] > 0.001)
-                    is_accurate = false;
-            }
-        }
-    }
-    return b;
-}
\ No newline at end of file
@@ -4,9 +4,11 @@
 #include <iostream>
 #include <algorithm>
 #include <iterator>
+#include <utility>
 #include <cstdlib>
 #include <string>
-#include "MyIterator.h"
+#include "../../common/MyNumVector.h"
+#include "../../common/MyThreadPool.h"
 
 using std::ostream;
 using std::istream;
@@ -27,7 +29,7 @@ ostream& operator<<(ostream &out, const MyVector<T> &src);
 
 /*! Overloaded insertion, fill contents of MyVector with input
  * @brief insertion operator to fill contents of MyVector with input
- * @pre cin must be called 'm_size' times to fill each vector element
+ * @pre cin must be called size() times to fill each vector element
  * @param[in,out] in istream object to perform inputting with
  * @param[in] src MyVector to be inputted with data
  * @post inputs the contents of the console to src
@@ -38,14 +40,13 @@ istream& operator>>(istream &in, MyVector<T> &src);
 
 /*! swap function, swaps contents of a and b vector with each other
  * @brief swap function, swaps contents of a and b with each other
- * @pre a and b must be vectors of the same size
+ * @pre none
  * @param[in,out] a vector object to be switched with 'b'
  * @param[in,out] b vector object to be switched with 'a'
- * @throw std::invalid_argument if a.m_size != b.m_size
- * @post swaps the contents of MyVector 'a' and 'b'
+ * @post swaps the storage (and sizes) of MyVector 'a' and 'b'
  */
 template <typename T>
-void swap(MyVector<T> &a, MyVector<T> &b);
+void swap(MyVector<T> &a, MyVector<T> &b) noexcept;
 
 /*! addition operator, for all element add by a's corresponding element
  * @brief addition, for all elements add by a's corresponding element
@@ -53,24 +54,48 @@ void swap(MyVector<T> &a, MyVector<T> &b);
  * @param[in] a vector of same size as b to add with
  * @param[in] b vector of same size as a to add with
  * @throw std::invalid_argument if a is not same size as b
- * @post for each element in both vectors, a.m_data[i] + b.m_data[i]
+ * @post for each element in both vectors, a.m_vec[i] + b.m_vec[i]
  * @returns the new MyVector after all addition is completed
  */
 template <typename T>
 MyVector<T> operator+(const MyVector<T> &a, const MyVector<T> &b);
 
+/*! addition operator, adds b into the storage of the temporary a
+ * @brief addition, for all elements add b's element into temporary a
+ * @pre a must be of same size as b, T must support addition
+ * @param[in,out] a temporary vector of same size as b, reused for result
+ * @param[in] b vector of same size as a to add with
+ * @throw std::invalid_argument if a is not same size as b
+ * @post adds b into a in place, so chained sums allocate only once
+ * @returns a, moved out after all addition is completed
+ */
+template <typename T>
+MyVector<T> operator+(MyVector<T> &&a, const MyVector<T> &b);
+
 /*! subtract operator, for all element minus by a's corresponding element
  * @brief subtraction, for all elements minus by a's corresponding element
  * @pre a must be of same size as b, T must support subtraction
  * @param[in] a vector of same size as b to subtract with
  * @param[in] b vector of same size as a to subtract with
  * @throw std::invalid_argument if a is not same size as b
- * @post for each element in both vectors, a.m_data[i] - b.m_data[i]
+ * @post for each element in both vectors, a.m_vec[i] - b.m_vec[i]
  * @returns the new MyVector after all subtraction is completed
  */
 template <typename T>
 MyVector<T> operator-(const MyVector<T> &a, const MyVector<T> &b);
 
+/*! subtract operator, subtracts b from the storage of the temporary a
+ * @brief subtraction, for all elements minus b's element from temporary a
+ * @pre a must be of same size as b, T must support subtraction
+ * @param[in,out] a temporary vector of same size as b, reused for result
+ * @param[in] b vector of same size as a to subtract with
+ * @throw std::invalid_argument if a is not same size as b
+ * @post subtracts b from a in place, so chained sums allocate only once
+ * @returns a, moved out after all subtraction is completed
+ */
+template <typename T>
+MyVector<T> operator-(MyVector<T> &&a, const MyVector<T> &b);
+
 /*! multiplication operator, multiply all elements of lhs by rhs
  * @brief scalar mult., multiply all elements of lhs by rhs
  * @pre T must be of type that supports multiplication
@@ -82,6 +107,17 @@ MyVector<T> operator-(const MyVector<T> &a, const MyVector<T> &b);
 template <typename T>
 MyVector<T> operator*(const MyVector<T> &lhs, const T &rhs);
 
+/*! multiplication operator, scales the storage of the temporary lhs
+ * @brief scalar mult., multiply all elements of temporary lhs by rhs
+ * @pre T must be of type that supports multiplication
+ * @param[in,out] lhs a temporary MyVector, reused for the result
+ * @param[in] rhs a scalar value of type T to multiply with
+ * @post multiplies all elements of lhs by rhs in place
+ * @returns lhs, moved out after multiplication performed
+ */
+template <typename T>
+MyVector<T> operator*(MyVector<T> &&lhs, const T &rhs);
+
 /*! multiplication operator, multiply all elements of lhs by rhs
  * @brief scalar mult., multiply all elements of lhs by rhs
  * @pre T must be of type that supports multiplication
@@ -104,28 +140,6 @@ MyVector<T> operator*(const T lhs, const MyVector<T> &rhs);
 template <typename T>
 T operator*(const MyVector<T> &lhs, const MyVector<T> &rhs);
 
-/*! Numerical exponentiation, compute x^n via squaring method
- * @brief computes x^n via squaring numerical exponentiation method
- * @param[in] x the base of the exponential to evaluate
- * @param[in] n the exponent of the exponential to evaluate (integer)
- * @post computes x^n via squaring method of numerical methods
- * @returns the computed x^n value
- */
-template <typename T>
-T exp_by_squaring(const T x, const int n);
-
-/*! Newton's method for nth root, calculates x^(1/n)
- * @brief uses newton's method to compute and return x^(1/n)
- * @pre n must not equal 0
- * @param[in] x the base of the nth root to evaluate
- * @param[in] n the denominator of the exponent (1/n) to raise x to
- * @throw std::invalid_argument if n == 0
- * @post computes the nth root of x to precision to 8 decimal places
- * @returns the computed nth root of x w/ precision to 8 decimal places
- */ 
-template <typename T>
-T sqrt_newton(const T x, const int n);
-
 /*! MyVector class
  * @brief custom vector implementation
  */
@@ -134,16 +148,19 @@ class MyVector
 {
 
     private:
-        T *m_data; //! dynamic array of size 'm_size' holding vector contents
-        size_t m_size; //! size_t variable representing size of m_data
+        MyNumVector<T> m_vec; //! shared small-buffer/aligned storage
 
     public:
-        /*! Default constructor, defaults to 0 vector with m_size 0
+        typedef T value_type;
+        typedef MyIterator<T> iterator; //! mutable contiguous iterator
+        typedef MyIterator<const T> const_iterator; //! read-only iterator
+
+        /*! Default constructor, defaults to 0 vector with size() 0
          * @brief Default constructor making zero vector with size of 0
          * @pre none
          * @post creates vector object with size 0
          */
-        MyVector(): m_data(nullptr), m_size(0) {}
+        MyVector(): m_vec() {}
 
         /*! Parameterized constructor, given initializer_list 'l'
          * @brief Parameterized constructor given initializer_list 'l'
@@ -155,10 +172,9 @@ class MyVector
 
         /*! Parameterized constructor, given size of MyVector 'space'
          * @brief Parameterized constructor, given size of vector 'space'
-         * @pre space must be positive
+         * @pre none
          * @param[in] space size_t representing size of MyVector storage
-         * @throw std::invalid_argument if space < 0
-         * @post creates a MyVector object with storage size 'space'
+         * @post creates a MyVector of 'space' value-initialized elements
          */
         explicit MyVector(const size_t space);
 
@@ -171,25 +187,27 @@ class MyVector
          */
         MyVector(const T *arr, const size_t n);
 
-        /*! Destructor, clears memory allocated to internal array
-         * @brief Destructor, clears memory allocated to internal array
-         * @pre none
-         * @post clears and deletes pointer to internal dynamic array
-         */
-        ~MyVector();
-
         /*! Copy constructor
          * @brief Copy constructor, creates identical MyVector object to src
          * @pre template type T must support assignment
          * @param[in] src the object to be copied to calling object
-         * @post creates MyVector with copy of src's m_data and m_size values
+         * @post creates MyVector with copy of src's elements
          */
         MyVector(const MyVector<T> &src);
 
+        /*! Move constructor
+         * @brief Move constructor, takes over the storage of src
+         * @pre none
+         * @param[in,out] src the object whose storage is taken over
+         * @post creates MyVector owning src's m_vec, leaves src empty
+         */
+        MyVector(MyVector<T> &&src) noexcept: m_vec(std::move(src.m_vec)) {}
+
         /*! Assignment operator, returns MyVector equal to given src
          * @brief Assignment operator, returns MyVector object equal to src
          * @pre template type T must support assignment
-         * @param[in] src copy of src vector to swap contents with to new obj
+         * @param[in] src copy of src vector to swap contents with to new obj,
+         *            moved (not copied) into when assigning from a temporary
          * @post swaps contents of calling object and src
          * @returns the modified calling object, contains contents of src
          */
@@ -197,10 +215,11 @@ class MyVector
 
         /*! Resize function, changes MyVector size to new_size
          * @brief Resize function, changes MyVector size to new_size
-         * @pre new_size must be positive
-         * @param[in] new_size size_t representing new dyn. array size
-         * @throw std::invalid_argument if size_t < 0
-         * @post modifies MyVector so dyn. array is resized and m_size set
+         * @pre none
+         * @param[in] new_size size_t representing new amount of elements
+         * @post keeps the first min(size(), new_size) elements and value
+         *       initializes the rest; reallocates only past the capacity,
+         *       which then at least doubles (see MyNumVector)
          */
         void resize(const size_t new_size);
 
@@ -212,23 +231,80 @@ class MyVector
          */
         size_t size() const;
 
-        /*! Subscript operator, returns val of m_data at index i
-         * @brief Subscript operator, returns val of m_data at index i
-         * @pre i must be in range 0 <= i < m_size
-         * @param[in] i size_t representing index to pull from m_data
-         * @throw std::out_of_range if i < 0 or i >= m_size
-         * @post returns the value of m_data[i]
-         * @returns the value of m_data[i]
+        /*! Reserve function, makes room for new_capacity elements
+         * @brief Reserve function, grows capacity to at least new_capacity
+         * @pre none
+         * @param[in] new_capacity amount of elements to make room for
+         * @post size and elements unchanged, appends up to new_capacity
+         *       elements do not reallocate
          */
-        T operator[](const size_t i) const;
+        void reserve(const size_t new_capacity)
+            { m_vec.reserve(new_capacity); }
 
-        /*! Subscript operator, returns ref. to val of m_data at index i
-         * @brief Subscript operator, returns ref. to val of m_data at index i
-         * @pre i must be in range 0 <= i < m_size
-         * @param[in] i size_t representing index to pull from m_data
-         * @throw std::out_of_range if i < 0 or i >= m_size
-         * @post returns a reference to value of m_data[i]
-         * @returns the reference to value of m_data[i]
+        /*! Capacity function, returns amount of elements room is made for
+         * @brief Capacity function, returns elements held w/o reallocating
+         * @pre none
+         * @post returns the capacity of m_vec
+         * @returns the capacity of MyVector
+         */
+        size_t capacity() const { return m_vec.capacity(); }
+
+        /*! push_back function, appends a copy of val to the end
+         * @brief push_back function, appends a copy of val to the end
+         * @pre none
+         * @param[in] val element to append
+         * @post size grows by one, amortized O(1)
+         */
+        void push_back(const T &val) { m_vec.push_back(val); }
+
+        /*! push_back function, moves val to the end
+         * @brief push_back function, appends val to the end by moving it
+         * @pre none
+         * @param[in,out] val element to move into the vector
+         * @post size grows by one, amortized O(1)
+         */
+        void push_back(T &&val) { m_vec.push_back(std::move(val)); }
+
+        /*! clear function, removes all elements
+         * @brief clear function, sets size to 0 keeping the capacity
+         * @pre none
+         * @post size is 0, the storage is kept for refilling
+         */
+        void clear() { m_vec.clear(); }
+
+        /*! Data function, returns pointer to the internal dynamic array
+         * @brief Data function, returns pointer to internal dynamic array
+         * @pre none
+         * @post returns pointer to m_vec, valid for size() elements
+         * @returns pointer to the first element of m_vec
+         */
+        T* data() { return m_vec.data(); }
+
+        /*! Data function, returns pointer to the internal dynamic array
+         * @brief Data function, returns read-only ptr to internal dyn. array
+         * @pre none
+         * @post returns pointer to m_vec, valid for size() elements
+         * @returns pointer to the first element of m_vec
+         */
+        const T* data() const { return m_vec.data(); }
+
+        /*! Subscript operator, returns const ref. to val of m_vec at index i
+         * @brief Subscript operator, returns const ref. to m_vec at index i
+         * @pre i must be in range 0 <= i < size()
+         * @param[in] i size_t representing index to pull from m_vec
+         * @throw std::out_of_range if i >= size() and BOUNDS_CHECKED
+         * @post returns a read-only reference to value of m_vec[i]
+         * @returns the read-only reference to value of m_vec[i]
+         */
+        const T& operator[](const size_t i) const;
+
+        /*! Subscript operator, returns ref. to val of m_vec at index i
+         * @brief Subscript operator, returns ref. to val of m_vec at index i
+         * @pre i must be in range 0 <= i < size()
+         * @param[in] i size_t representing index to pull from m_vec
+         * @throw std::out_of_range if i >= size() and BOUNDS_CHECKED
+         * @post returns a reference to value of m_vec[i]
+         * @returns the reference to value of m_vec[i]
          */
         T& operator[](const size_t i);
 
@@ -236,7 +312,7 @@ class MyVector
          * @brief apply function, returns new vector with func on each element
          * @pre function must be of form func(T) with return type T
          * @param[in] func function of form func(T) with return type T
-         * @post applies func() to all elements in m_data, return modified obj
+         * @post applies func() to all elements in m_vec, return modified obj
          * @returns the modified vector with func() applied to all elements
          */
         MyVector<T>& apply(T(*func)(T));
@@ -249,6 +325,35 @@ class MyVector
          */
         MyVector<T>& operator-();
 
+        /*! addition assignment, adds rhs to the vector in place
+         * @brief addition assign., for all elements add rhs's element
+         * @pre rhs must be of same size as calling obj, T must support addition
+         * @param[in] rhs vector of same size to add with
+         * @throw std::invalid_argument if rhs is not same size
+         * @post for each element, m_vec[i] += rhs.m_vec[i], no allocation
+         * @returns the modified calling object
+         */
+        MyVector<T>& operator+=(const MyVector<T> &rhs);
+
+        /*! subtraction assignment, subtracts rhs from the vector in place
+         * @brief subtraction assign., for all elements minus rhs's element
+         * @pre rhs must be of same size as calling obj, T must support minus
+         * @param[in] rhs vector of same size to subtract with
+         * @throw std::invalid_argument if rhs is not same size
+         * @post for each element, m_vec[i] -= rhs.m_vec[i], no allocation
+         * @returns the modified calling object
+         */
+        MyVector<T>& operator-=(const MyVector<T> &rhs);
+
+        /*! multiplication assignment, scales the vector in place
+         * @brief scalar mult. assign., multiply all elements by rhs
+         * @pre T must be of type that supports multiplication
+         * @param[in] rhs a scalar value of type T to multiply with
+         * @post for each element, m_vec[i] *= rhs, no allocation
+         * @returns the modified calling object
+         */
+        MyVector<T>& operator*=(const T &rhs);
+
         /*! P-norm evaluator, calculates the p-norm of vector
          * @brief calculates and returns p-norm of lhs of ^ operator
          * @pre exponentiation (squaring) must be supported for template type T
@@ -258,26 +363,57 @@ class MyVector
          */
         T operator^(const int p) const;
 
-        /*! begin() function, returns iter at beginning of m_data
-         * @brief begin() function, returns iter at beginning of m_data
+        /*! begin() function, returns iter at beginning of m_vec
+         * @brief begin() function, returns iter at beginning of m_vec
+         * @pre none
+         * @post returns an iterator to beginning of m_vec
+         * @returns a mutable iterator to beginning of m_vec
+         */
+        iterator begin() { return m_vec.begin(); }
+
+        /*! begin() function, returns read-only iter at beginning of m_vec
+         * @brief begin() function, returns const iter at start of m_vec
+         * @pre none
+         * @post returns a read-only iterator to beginning of m_vec
+         * @returns a const iterator to beginning of m_vec
+         */
+        const_iterator begin() const { return m_vec.begin(); }
+
+        /*! end() function, returns iter at end of m_vec
+         * @brief end() function, returns iter at end of m_vec
+         * @pre none
+         * @post returns an iterator to end of m_vec
+         * @returns a mutable iterator one past the end of m_vec
+         */
+        iterator end() { return m_vec.end(); }
+
+        /*! end() function, returns read-only iter at end of m_vec
+         * @brief end() function, returns const iter at end of m_vec
+         * @pre none
+         * @post returns a read-only iterator to end of m_vec
+         * @returns a const iterator one past the end of m_vec
+         */
+        const_iterator end() const { return m_vec.end(); }
+
+        /*! cbegin() function, returns read-only iter at beginning of m_vec
+         * @brief cbegin() function, const iter at beginning of m_vec
          * @pre none
-         * @post returns an iterator to beginning of m_data
-         * @returns an iterator to beginning of m_data
+         * @post returns a read-only iterator to beginning of m_vec
+         * @returns a const iterator to beginning of m_vec
          */
-        MyIterator<T> begin() const { return MyIterator<T>(m_data); }
-        
-        /*! end() function, returns iter at end of m_data
-         * @brief end() function, returns iter at end of m_data
+        const_iterator cbegin() const { return begin(); }
+
+        /*! cend() function, returns read-only iter at end of m_vec
+         * @brief cend() function, const iter at end of m_vec
          * @pre none
-         * @post returns an iterator to end of m_data
-         * @returns an iterator to end of m_data
+         * @post returns a read-only iterator to end of m_vec
+         * @returns a const iterator one past the end of m_vec
          */
-        MyIterator<T> end() const 
-            { return MyIterator<T>(m_data + unsigned(m_size)); }
+        const_iterator cend() const { return end(); }
 
         /*! Overloaded insertion, fill contents of MyVector with input
          * @brief insertion operator to fill contents of MyVector with input
-         * @pre cin must be called 'm_size' times to fill each vector element
+         * @pre cin must be called size() times to fill each vector element
          * @param[in,out] out ostream object to perform outputting with
          * @param[in] src MyVector to be outputted to the console
          * @post outputs the contents of src to the console
@@ -285,15 +421,24 @@ class MyVector
          */
          friend istream& operator>><T>(istream &in, MyVector<T> &src);
 
+        /*! Overloaded output, output contents of MyVector
+         * @brief output operator to output contents of MyVector to console
+         * @pre type T must be capable of outputting to console
+         * @param[in,out] out ostream object to perform outputting with
+         * @param[in] src MyVector to be outputted to the console
+         * @post outputs the contents of src to the console
+         * @returns the modified ostream object
+         */
+        friend ostream& operator<<<T>(ostream &out, const MyVector<T> &src);
+
         /*! swap function, swaps contents of a and b vector with each other
          * @brief swap function, swaps contents of a and b with each other
-         * @pre a and b must be vectors of the same size
+         * @pre none
          * @param[in,out] a vector object to be switched with 'b'
          * @param[in,out] b vector object to be switched with 'a'
-         * @throw std::invalid_argument if a.m_size != b.m_size
-         * @post swaps the contents of MyVector 'a' and 'b'
+         * @post swaps the storage (and sizes) of MyVector 'a' and 'b'
          */
-        friend void swap<T>(MyVector<T> &a, MyVector<T> &b);
+        friend void swap<T>(MyVector<T> &a, MyVector<T> &b) noexcept;
 };
 
 #include "MyVector.hpp"
@@ -1,158 +1,136 @@
 template <typename T>
-MyVector<T>::MyVector(const std::initializer_list<T> &l)
-{
-    m_data = new T[l.size()];
-    m_size = l.size();
-    std::copy(l.begin(), l.end(), m_data);
-}
+MyVector<T>::MyVector(const std::initializer_list<T> &l): m_vec(l) {}
 
 template <typename T>
-MyVector<T>::MyVector(const size_t space)
-{
-    if(space < 0)
-        throw std::invalid_argument("m_size must be positive");
+MyVector<T>::MyVector(const size_t space): m_vec(space) {}
 
-    m_data = new T[space];
-    m_size = space;
-}
+template <typename T>
+MyVector<T>::MyVector(const T *arr, const size_t n): m_vec(arr, n) {}
+
+template <typename T>
+MyVector<T>::MyVector(const MyVector<T> &src): m_vec(src.m_vec) {}
 
 template <typename T>
-MyVector<T>::MyVector(const T *arr, const size_t n)
+MyVector<T>& MyVector<T>::operator=(MyVector<T> src)
 {
-    m_size = n;
-    m_data = new T[m_size];
-    for(size_t i = 0; i < m_size; i++)
-        m_data[i] = arr[i];
+    // src is already a copy (or the moved temporary), so taking over its
+    // storage is enough, the old storage is freed along with src
+    swap(*this, src);
+    return *this;
 }
 
 template <typename T>
-MyVector<T>::~MyVector()
+void MyVector<T>::resize(const size_t new_size)
 {
-    delete[] m_data;
+    m_vec.resize(new_size);
 }
 
 template <typename T>
-MyVector<T>::MyVector(const MyVector<T> &src)
+size_t MyVector<T>::size() const
 {
-    m_size = src.m_size;
-    m_data = new T[m_size];
-    for(size_t i = 0; i < m_size; i++)
-        m_data[i] = src.m_data[i];
+    return m_vec.size();
 }
 
 template <typename T>
-MyVector<T>& MyVector<T>::operator=(MyVector<T> src)
+MyVector<T>& MyVector<T>::apply(T(*func)(T))
 {
-    if(src.size() != size())
-        resize(src.size());
-    swap(*this, src);
+    m_vec.apply(func);
     return *this;
 }
 
 template <typename T>
-void MyVector<T>::resize(const size_t new_size)
+MyVector<T>& MyVector<T>::operator-()
 {
-    if(new_size < 0)
-        throw std::invalid_argument("m_size must be positive");
-
-    size_t smaller_size = std::min(new_size, m_size);
-
-    T *m_data_copy = new T[smaller_size];
-    for(size_t i = 0; i < smaller_size; i++)
-        m_data_copy[i] = m_data[i];
-        
-    delete[] m_data;
-    m_data = new T[new_size];
-    for(size_t i = 0; i < smaller_size; i++)
-        m_data[i] = m_data_copy[i];
-
-    m_size = new_size;
-    delete[] m_data_copy;
+    -m_vec;
+    return *this;
 }
 
 template <typename T>
-size_t MyVector<T>::size() const
+MyVector<T>& MyVector<T>::operator+=(const MyVector<T> &rhs)
 {
-    return m_size;
+    if(rhs.size() != size())
+        throw std::invalid_argument("lhs and rhs of += not same size");
+
+    T *data = m_vec.data();
+    const T *rhs_data = rhs.data();
+    parallel_for(size(), 1, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            data[i] += rhs_data[i];
+    });
+    return *this;
 }
 
 template <typename T>
-MyVector<T>& MyVector<T>::apply(T(*func)(T))
+MyVector<T>& MyVector<T>::operator-=(const MyVector<T> &rhs)
 {
-    for(size_t i = 0; i < m_size; i++)
-        m_data[i] = func(m_data[i]);
+    if(rhs.size() != size())
+        throw std::invalid_argument("lhs and rhs of -= not same size");
+
+    T *data = m_vec.data();
+    const T *rhs_data = rhs.data();
+    parallel_for(size(), 1, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            data[i] -= rhs_data[i];
+    });
     return *this;
 }
 
 template <typename T>
-MyVector<T>& MyVector<T>::operator-()
+MyVector<T>& MyVector<T>::operator*=(const T &rhs)
 {
-    for(size_t i = 0; i < m_size; i++)
-        m_data[i] *= -1;
+    T *data = m_vec.data();
+    parallel_for(size(), 1, [&](const size_t lo, const size_t hi)
+    {
+        for(size_t i = lo; i < hi; i++)
+            data[i] *= rhs;
+    });
     return *this;
 }
 
 template <typename T>
 T MyVector<T>::operator^(const int p) const
 {
-    T sum = 0;
-    for(size_t i = 0; i < m_size; i++)
-        sum += exp_by_squaring(m_data[i] < 0 ? -m_data[i] : m_data[i], p);
+    const T *data = m_vec.data();
+    T sum = parallel_sum<T>(size(), 1, [&](const size_t lo, const size_t hi) -> T
+    {
+        T piece = 0;
+        for(size_t i = lo; i < hi; i++)
+            piece += exp_by_squaring(data[i] < 0 ? -data[i] : data[i], p);
+        return piece;
+    });
     return sqrt_newton(double(sum), p);
 }
 
 template <typename T>
-T MyVector<T>::operator[](const size_t i) const
+const T& MyVector<T>::operator[](const size_t i) const
 {
-    if(i < 0 || i >= m_size)
-        throw std::out_of_range("i is not in range of vector");
-    return m_data[i];
+    return m_vec[i];
 }
 
 template <typename T>
 T& MyVector<T>::operator[](const size_t i)
 {
-    if(i < 0 || i >= m_size)
-        throw std::out_of_range("i is not in range of vector");
-    return m_data[i];
+    return m_vec[i];
 }
 
 template <typename T>
 ostream& operator<<(ostream &out, const MyVector<T> &src)
 {
-    for(size_t i = 0; i < src.size() - 1; i++)
-        out << src[i] << " ";
-    if(src.size() != 0)
-        out << src[src.size() - 1];
-    return out;
+    return out << src.m_vec;
 }
 
 template <typename T>
 istream& operator>>(istream &in, MyVector<T> &src)
 {
-    std::istream_iterator<T> eos;
-    std::istream_iterator<T> iit(in);
-
-    delete[] src.m_data;
-    src.resize(0);
-    int current_index = 0;
-
-    while(iit != eos)
-    {
-        src.resize(src.size() + 1);
-        src.m_data[current_index] = *iit;
-        current_index++;
-        iit++;
-    }
-    
-    return in;
+    return in >> src.m_vec;
 }
 
 template <typename T>
-void swap(MyVector<T> &a, MyVector<T> &b)
+void swap(MyVector<T> &a, MyVector<T> &b) noexcept
 {
-    std::swap(a.m_size, b.m_size);
-    std::swap(a.m_data, b.m_data);
+    swap(a.m_vec, b.m_vec);
 }
 
 template <typename T>
@@ -161,83 +139,76 @@ MyVector<T> operator+(const MyVector<T> &a, const MyVector<T> &b)
     if(a.size() != b.size())
         throw std::invalid_argument("lhs and rhs of + not same size");
 
-    T *m_data_copy = new T[a.size()];
-    for(size_t i = 0; i < a.size(); i++)
-        m_data_copy[i] = a[i] + b[i];
-    
-    MyVector<T> new_vect(m_data_copy, a.size());
-    delete[] m_data_copy;
+    MyVector<T> new_vect(a);
+    new_vect += b;
     return new_vect;
 }
 
+template <typename T>
+MyVector<T> operator+(MyVector<T> &&a, const MyVector<T> &b)
+{
+    if(a.size() != b.size())
+        throw std::invalid_argument("lhs and rhs of + not same size");
+
+    a += b;
+    return std::move(a);
+}
+
 template <typename T>
 MyVector<T> operator-(const MyVector<T> &a, const MyVector<T> &b)
 {
     if(a.size() != b.size())
         throw std::invalid_argument("lhs and rhs of - not same size");
 
-    T *m_data_copy = new T[a.size()];
-    for(size_t i = 0; i < a.size(); i++)
-        m_data_copy[i] = a[i] - b[i];
-    
-    MyVector<T> new_vect(m_data_copy, a.size());
-    delete[] m_data_copy;
+    MyVector<T> new_vect(a);
+    new_vect -= b;
     return new_vect;
 }
 
 template <typename T>
-MyVector<T> operator*(const MyVector<T> &lhs, const T &rhs)
+MyVector<T> operator-(MyVector<T> &&a, const MyVector<T> &b)
 {
-    T *m_data_copy = new T[lhs.size()];
-    for(size_t i = 0; i < lhs.size(); i++)
-        m_data_copy[i] = lhs[i] * rhs;
-    
-    MyVector<T> new_vect(m_data_copy, lhs.size());
-    delete[] m_data_copy;
-    return new_vect;
+    if(a.size() != b.size())
+        throw std::invalid_argument("lhs and rhs of - not same size");
+
+    a -= b;
+    return std::move(a);
 }
 
 template <typename T>
-MyVector<T> operator*(const T lhs, const MyVector<T> &rhs)
+MyVector<T> operator*(const MyVector<T> &lhs, const T &rhs)
 {
-    return (rhs * lhs);
+    MyVector<T> new_vect(lhs);
+    new_vect *= rhs;
+    return new_vect;
 }
 
 template <typename T>
-T operator*(const MyVector<T> &lhs, const MyVector<T> &rhs)
+MyVector<T> operator*(MyVector<T> &&lhs, const T &rhs)
 {
-    if(lhs.size() != rhs.size())
-        throw std::invalid_argument("lhs and rhs for * not of same size");
-
-    T sum = 0;
-    for(size_t i = 0; i < lhs.size(); i++)
-        sum += (lhs[i] * rhs[i]);
-    return sum;
+    lhs *= rhs;
+    return std::move(lhs);
 }
 
 template <typename T>
-T exp_by_squaring(const T x, const int n)
+MyVector<T> operator*(const T lhs, const MyVector<T> &rhs)
 {
-    if(n < 0)
-        return exp_by_squaring(1.0 / x, -n);
-    else if(n == 0)
-        return 1;
-    else if(n == 1)
-        return x;
-    else if(n % 2 == 0)
-        return exp_by_squaring(x * x, n / 2);
-    return x * exp_by_squaring(x * x, (n - 1) / 2);
+    return (rhs * lhs);
 }
 
 template <typename T>
-T sqrt_newton(const T x, const int n)
+T operator*(const MyVector<T> &lhs, const MyVector<T> &rhs)
 {
-    T xn = x;
-    T xn_next;
-    for(int i = 0; i < 10; i++)
+    if(lhs.size() != rhs.size())
+        throw std::invalid_argument("lhs and rhs for * not of same size");
+
+    const T *l = lhs.data();
+    const T *r = rhs.data();
+    return parallel_sum<T>(lhs.size(), 1, [&](const size_t lo, const size_t hi) -> T
     {
-        xn_next = (1.0/n) * ((n-1)*xn + (x/exp_by_squaring(xn, n-1)));
-        xn = xn_next;
-    }
-    return xn_next;
-}
\ No newline at end of file
+        T sum = 0;
+        for(size_t i = lo; i < hi; i++)
+            sum += (l[i] * r[i]);
+        return sum;
+    });
+}
@@ -28,10 +28,10 @@ class QuantumGate
         /*! virtual operator[], returns quantum gate's matrix
          * @brief virtual operator[], returns quantum gate's matrix
          * @pre none
-         * @post accesses the vector inside matrix 'gate' at index 'i'
-         * @returns the given quantum gate object's matrix
+         * @post accesses the matrix 'gate', without copying it
+         * @returns read-only reference to the given quantum gate's matrix
          */
-        virtual MyMatrix<MyComplex<double>> get_gate() const { return gate; }
+        virtual const MyMatrix<MyComplex<double>>& get_gate() const { return gate; }
 
         /*! gets required qubit size comptabile with given gate
          * @brief gets required qubit size compatible with given gate